@@ -0,0 +1,96 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file msgq_syscalls.c
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Syscall implementation for putting/getting several messages with
+ *        k_msgq_put()/k_msgq_get() in one call
+ *
+ *
+ * @date 2026-04-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include "msgq_syscalls.h"
+
+#include <zephyr/internal/syscall_handler.h>
+
+// Puts/gets messages without waiting, with the scheduler locked so that a thread
+// woken up by the first message only runs once the whole batch is transferred
+static uint32_t msgq_transfer_no_wait(struct k_msgq* msgq, char* data, uint32_t count, bool put) {
+  bool lock   = !k_is_in_isr();
+  uint32_t nbr = 0;
+  if (lock) {
+    k_sched_lock();
+  }
+  while (nbr < count) {
+    char* p_msg = data + (nbr * msgq->msg_size);
+    int ret     = put ? k_msgq_put(msgq, p_msg, K_NO_WAIT) : k_msgq_get(msgq, p_msg, K_NO_WAIT);
+    if (ret != 0) {
+      break;
+    }
+    nbr++;
+  }
+  if (lock) {
+    k_sched_unlock();
+  }
+  return nbr;
+}
+
+static int msgq_transfer_n(struct k_msgq* msgq, char* data, uint32_t count, k_timeout_t timeout, bool put) {
+  if (count == 0) {
+    return 0;
+  }
+  uint32_t nbr = msgq_transfer_no_wait(msgq, data, count, put);
+  if (nbr > 0 || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+    return nbr > 0 ? (int)nbr : -ENOMSG;
+  }
+  // wait for the first message, then transfer the others without waiting
+  int ret = put ? k_msgq_put(msgq, data, timeout) : k_msgq_get(msgq, data, timeout);
+  if (ret != 0) {
+    return ret;
+  }
+  nbr = 1 + msgq_transfer_no_wait(msgq, data + msgq->msg_size, count - 1, put);
+  return (int)nbr;
+}
+
+// Implementations run in supervisor mode
+int z_impl_msgq_syscall_put_n(struct k_msgq* msgq, const void* data, uint32_t count, k_timeout_t timeout) {
+  // messages are only read when putting
+  return msgq_transfer_n(msgq, (char*)data, count, timeout, true);  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+}
+
+int z_impl_msgq_syscall_get_n(struct k_msgq* msgq, void* data, uint32_t max_count, k_timeout_t timeout) {
+  return msgq_transfer_n(msgq, (char*)data, max_count, timeout, false);  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+}
+
+// Verification functions — the message queue must be granted to the calling thread
+// and the messages must be in its memory domain
+static inline int z_vrfy_msgq_syscall_put_n(struct k_msgq* msgq, const void* data, uint32_t count, k_timeout_t timeout) {
+  K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+  K_OOPS(K_SYSCALL_MEMORY_ARRAY_READ(data, count, msgq->msg_size));
+  return z_impl_msgq_syscall_put_n(msgq, data, count, timeout);
+}
+
+static inline int z_vrfy_msgq_syscall_get_n(struct k_msgq* msgq, void* data, uint32_t max_count, k_timeout_t timeout) {
+  K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+  K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(data, max_count, msgq->msg_size));
+  return z_impl_msgq_syscall_get_n(msgq, data, max_count, timeout);
+}
+
+#include <zephyr/syscalls/msgq_syscall_put_n_mrsh.c>  // NOLINT(build/include)
+#include <zephyr/syscalls/msgq_syscall_get_n_mrsh.c>  // NOLINT(build/include)
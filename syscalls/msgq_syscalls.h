@@ -0,0 +1,48 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file msgq_syscalls.h
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Syscall declaration for putting/getting several messages with
+ *        k_msgq_put()/k_msgq_get() in one call
+ *
+ *
+ * @date 2026-04-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Put up to count messages, waiting until at least one can be put.
+// Returns the number of messages put or a negative error code as k_msgq_put().
+__syscall int msgq_syscall_put_n(struct k_msgq* msgq, const void* data, uint32_t count, k_timeout_t timeout);
+
+// Get up to max_count messages, waiting until at least one is available.
+// Returns the number of messages got or a negative error code as k_msgq_get().
+__syscall int msgq_syscall_get_n(struct k_msgq* msgq, void* data, uint32_t max_count, k_timeout_t timeout);
+
+#include <zephyr/syscalls/msgq_syscalls.h>
+
+#ifdef __cplusplus
+}
+#endif
@@ -13,25 +13,23 @@
 // limitations under the License.
 
 /****************************************************************************
- * @file car_system.hpp
+ * @file barrier.hpp
  * @author Serge Ayer <serge.ayer@hefr.ch>
  *
- * @brief Car System header file
+ * @brief Barrier class declaration
  *
- * @date 2025-07-01
+ * @date 2025-08-31
  * @version 1.0.0
  ***************************************************************************/
 
 #pragma once
 
-// stl
 #include <chrono>
-#include <functional>
 
-// zpp_lib
+#include "zpp_include/event.hpp"
+#include "zpp_include/inplace_function.hpp"
 #include "zpp_include/mutex.hpp"
 #include "zpp_include/non_copyable.hpp"
-#include "zpp_include/semaphore.hpp"
 #include "zpp_include/time.hpp"
 
 #if CONFIG_USERSPACE
@@ -40,10 +38,21 @@
 
 namespace zpp_lib {
 
+/** The Barrier class blocks a fixed number of threads until all of them reached the
+ barrier. The barrier is reusable: once all threads are released, the next phase starts
+ and the threads may wait on the barrier again.
+
+ The last thread reaching the barrier gets the time, which is returned to all threads of
+ the phase, and runs the optional completion function before the other threads are
+ released. All waiting threads are released at once by setting an event flag.
+*/
 class Barrier : NonCopyable {
 public:
+  // function run by the last thread of each phase, with the synchronized time
+  using CompletionFunction = InplaceFunction<void(const std::chrono::microseconds&)>;
+
   // constructor and destructor
-  explicit Barrier(uint32_t nbr_of_threads);
+  explicit Barrier(uint32_t nbr_of_threads, CompletionFunction completion = nullptr);
   ~Barrier() = default;
 
   /** Wait for all thread to reach the barrier, last thread gets the time and
@@ -52,25 +61,34 @@ public:
    *  @note This function is NOT ISR-safe.
    */
 #if CONFIG_TEST
-  using ZeroTimeCB = std::function<void(const std::chrono::microseconds&)>;
+  using ZeroTimeCB = CompletionFunction;
   std::chrono::microseconds wait(const ZeroTimeCB& zero_time_cb);
-#else
-  std::chrono::microseconds wait();
 #endif
+  std::chrono::microseconds wait();
+
+  /** Get the number of phases completed since the barrier was created
+   */
+  [[nodiscard]] uint32_t get_generation();
 
 #if CONFIG_USERSPACE
   void grant_access(k_tid_t tid);
 #endif  // CONFIG_USERSPACE
 
 private:
-  zpp_lib::Semaphore _wait_semaphore;
+  // waits on the barrier, zero_time_cb is called by the last thread if not empty
+  std::chrono::microseconds wait_phase(const CompletionFunction& zero_time_cb);
+
+  zpp_lib::Event _event;
   zpp_lib::Mutex _mutex;
-  // number of threads still waiting
+  CompletionFunction _completion;
+  // number of threads still waiting in the current phase
   uint32_t _count;
   // total thread count
   uint32_t _total;
-  // shared start time (same for all threads)
-  static std::chrono::microseconds _start_time;
+  // number of completed phases
+  uint32_t _generation = 0;
+  // synchronized time of the last completed phase (same for all threads)
+  std::chrono::microseconds _start_time{0};
 };
 
 }  // namespace zpp_lib
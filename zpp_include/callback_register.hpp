@@ -26,10 +26,10 @@
 
 // std
 #include <cstddef>
-#include <functional>
 #include <map>
 
 // zpp_lib
+#include "zpp_include/inplace_function.hpp"
 #include "zpp_include/registration_token.hpp"
 
 namespace zpp_lib {
@@ -39,7 +39,7 @@ class InterruptIn;
 
 class CallbackRegister {
 public:
-  using CallbackFunction = std::function<void()>;
+  using CallbackFunction = InplaceFunction<void()>;
   CallbackRegister(InterruptIn& owner);
   virtual ~CallbackRegister();
 
@@ -0,0 +1,157 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file channel.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief CPP class declaration/implementation of a typed queue of movable messages
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/clock.h>
+
+// std
+#include <chrono>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// zpp_lib
+#include "zpp_include/clock.hpp"
+#include "zpp_include/non_copyable.hpp"
+#include "zpp_include/zephyr_result.hpp"
+
+namespace zpp_lib {
+
+/** The Channel class is a queue of at most N messages of type T that are moved in and
+ out of the queue instead of being copied with memcpy as with MessageQueue. It may thus
+ transfer move-only or non trivially copyable types such as std::unique_ptr.
+ Messages are constructed in nodes allocated from a pool (k_mem_slab) owned by the
+ channel and nodes are linked in a k_fifo, so that messages are never copied by the kernel.
+
+ @note The pool of nodes is not a kernel object that can be granted to user threads:
+       the channel may only be used from supervisor threads (or from ISR with a zero timeout).
+*/
+template <typename T, uint32_t N> class Channel final : private NonCopyable {
+  static_assert(N > 0, "Channel size must be strictly positive");
+  static_assert(std::is_move_constructible_v<T>, "Channel messages must be move constructible");
+  static_assert(std::is_move_assignable_v<T>, "Channel messages must be move assignable");
+  static_assert(std::is_nothrow_destructible_v<T>, "Channel messages must be nothrow destructible");
+
+public:
+  Channel() {
+    k_fifo_init(&_fifo);
+    [[maybe_unused]] auto ret = k_mem_slab_init(&_slab, _slab_buffer, sizeof(Node), N);
+    __ASSERT(ret == 0, "Cannot initialize channel pool: %d", ret);
+  }
+
+  ~Channel() {
+    // destroy the messages still in the channel, the nodes go away with the pool
+    void* p_node = nullptr;
+    while ((p_node = k_fifo_get(&_fifo, K_NO_WAIT)) != nullptr) {
+      static_cast<Node*>(p_node)->value()->~T();
+    }
+  }
+
+  /** Construct a message in place from args, waiting until the channel is not full or
+    a timeout expires.
+    @return true if the message was put, false otherwise.
+   */
+  template <typename... Args> [[nodiscard]] ZephyrBoolResult try_emplace_for(const std::chrono::microseconds& timeout, Args&&... args) {
+    static_assert(std::is_constructible_v<T, Args...>, "Channel message cannot be constructed from these arguments");
+    auto k_timeout = microseconds_to_ticks(timeout);
+    void* p_block  = nullptr;
+    auto ret       = k_mem_slab_alloc(&_slab, &p_block, k_timeout);
+    ZephyrBoolResult res;
+    if ((K_TIMEOUT_EQ(k_timeout, K_NO_WAIT) && ret == -ENOMEM) || (!K_TIMEOUT_EQ(k_timeout, K_NO_WAIT) && ret == -EAGAIN)) {
+      // timeout -> return false without error
+      res.assign_value(false);
+    } else if (ret != 0) {
+      // other failure -> return false with error
+      __ASSERT(false, "Cannot allocate channel node: %d (timeout is %lld usecs)", ret, timeout.count());
+      res.assign_value(false);
+      res.assign_error(zephyr_to_zpp_error_code(ret));
+    } else {
+      auto* p_node = new (p_block) Node;
+      new (p_node->storage) T(std::forward<Args>(args)...);
+      atomic_inc(&_nbr_of_queued);
+      k_fifo_put(&_fifo, p_node);
+    }
+    return res;
+  }
+
+  /** Move a message into the channel, waiting until the channel is not full or a timeout
+    expires. value is left in its moved-from state only if the message was put.
+    @return true if the message was put, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_put_for(const std::chrono::microseconds& timeout, T&& value) {
+    return try_emplace_for(timeout, std::move(value));
+  }
+
+  /** Move a message out of the channel, waiting until one is available or a timeout expires.
+    @return true if a message was got, false otherwise.
+
+    @note You cannot call this function from ISR context with a non-zero timeout.
+   */
+  [[nodiscard]] ZephyrBoolResult try_get_for(const std::chrono::microseconds& timeout, T& value) {
+    auto* p_node = static_cast<Node*>(k_fifo_get(&_fifo, microseconds_to_ticks(timeout)));
+    ZephyrBoolResult res;
+    if (p_node == nullptr) {
+      // timeout -> return false without error
+      res.assign_value(false);
+      return res;
+    }
+    atomic_dec(&_nbr_of_queued);
+    T* p_value = p_node->value();
+    value      = std::move(*p_value);
+    p_value->~T();
+    k_mem_slab_free(&_slab, p_node);
+    return res;
+  }
+
+  uint32_t get_nbr_of_queued_messages() const {
+    return static_cast<uint32_t>(atomic_get(&_nbr_of_queued));
+  }
+
+  [[nodiscard]] static constexpr uint32_t capacity() noexcept {
+    return N;
+  }
+
+private:
+  struct Node {
+    // first word reserved for use by the kernel fifo
+    void* fifo_reserved = nullptr;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* value() noexcept {
+      return std::launder(reinterpret_cast<T*>(storage));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+  };
+
+  struct k_fifo _fifo;
+  struct k_mem_slab _slab;
+  atomic_t _nbr_of_queued = ATOMIC_INIT(0);
+  alignas(Node) char _slab_buffer[sizeof(Node) * N];
+};  // NOLINT(readability/braces)
+
+}  // namespace zpp_lib
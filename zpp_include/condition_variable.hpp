@@ -0,0 +1,175 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file condition_variable.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief CPP class declaration for wrapping zephyr os condition variable
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// stl
+#include <chrono>
+#include <mutex>
+
+// zpp_lib
+#include "zpp_include/kernel_object_pool.hpp"
+#include "zpp_include/mutex.hpp"
+#include "zpp_include/non_copyable.hpp"
+#include "zpp_include/zephyr_result.hpp"
+
+namespace zpp_lib {
+
+/** The ConditionVariable class blocks threads until another thread modifies a shared
+ condition protected by a Mutex and notifies the condition variable.
+
+ As for std::condition_variable, the mutex is given as a std::unique_lock that owns it:
+ the mutex is released while waiting and owned again when the wait returns. Waits may
+ return spuriously, the versions taking a predicate wait until the predicate is true.
+
+ @note You cannot use member functions of this class in ISR context.
+ @note With CONFIG_ZPP_MUTEX_FUTEX, the condition variable is implemented with a futex
+ sequence number instead of k_condvar, which requires a k_mutex.
+*/
+class ConditionVariable final : private NonCopyable {
+public:
+  /** Create and Initialize a ConditionVariable object
+   *
+   * @note You cannot call this function from ISR context.
+   */
+  ConditionVariable() noexcept;
+
+  /** ConditionVariable destructor
+   *
+   * @note You cannot call this function from ISR context.
+   */
+  ~ConditionVariable();
+
+  /** Wait until the condition variable is notified
+    @param   lock  lock owning the mutex protecting the condition.
+   */
+  [[nodiscard]] ZephyrResult wait(std::unique_lock<Mutex>& lock);
+
+  /** Wait until the predicate is true
+    @param   lock  lock owning the mutex protecting the condition.
+    @param   pred  predicate evaluated with the mutex owned.
+   */
+  template <typename Predicate>
+  [[nodiscard]] ZephyrResult wait(std::unique_lock<Mutex>& lock, Predicate pred) {
+    while (!pred()) {
+      auto res = wait(lock);
+      if (!res) {
+        return res;
+      }
+    }
+    return ZephyrResult();
+  }
+
+  /** Wait until the condition variable is notified or a timeout expires
+    @param   lock     lock owning the mutex protecting the condition.
+    @param   timeout  timeout value.
+    @return false if the timeout expired, true otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult wait_for(std::unique_lock<Mutex>& lock, const std::chrono::milliseconds& timeout);
+
+  /** Wait until the predicate is true or a timeout expires
+    @param   lock     lock owning the mutex protecting the condition.
+    @param   timeout  timeout value.
+    @param   pred     predicate evaluated with the mutex owned.
+    @return the value of the predicate when the wait returns.
+   */
+  template <typename Predicate>
+  [[nodiscard]] ZephyrBoolResult wait_for(std::unique_lock<Mutex>& lock, const std::chrono::milliseconds& timeout, Predicate pred) {
+    return wait_until(lock, deadline_after(timeout), pred);
+  }
+
+  /** Wait until the condition variable is notified or an absolute time is reached
+    @param   lock           lock owning the mutex protecting the condition.
+    @param   absolute_time  time since boot at which the wait expires.
+    @return false if the absolute time was reached, true otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult wait_until(std::unique_lock<Mutex>& lock, const std::chrono::microseconds& absolute_time);
+
+  /** Wait until the predicate is true or an absolute time is reached
+    @param   lock           lock owning the mutex protecting the condition.
+    @param   absolute_time  time since boot at which the wait expires.
+    @param   pred           predicate evaluated with the mutex owned.
+    @return the value of the predicate when the wait returns.
+   */
+  template <typename Predicate>
+  [[nodiscard]] ZephyrBoolResult wait_until(std::unique_lock<Mutex>& lock,
+                                            const std::chrono::microseconds& absolute_time,
+                                            Predicate pred) {
+    while (!pred()) {
+      auto res = wait_until(lock, absolute_time);
+      if (res.has_error()) {
+        return res;
+      }
+      if (!res) {
+        // timeout -> the predicate may have become true meanwhile
+        res.assign_value(pred());
+        return res;
+      }
+    }
+    return ZephyrBoolResult();
+  }
+
+  /** Wake up one thread waiting on the condition variable
+   */
+  void notify_one() noexcept;
+
+  /** Wake up all threads waiting on the condition variable
+   */
+  void notify_all() noexcept;
+
+#if CONFIG_USERSPACE
+  /**
+   * Grants access to the k_condvar kernel object for a specific thread
+   */
+  void grant_access(k_tid_t tid);
+
+  /**
+   * Get the usage statistics of the pool of k_condvar kernel objects
+   */
+  [[nodiscard]] static KernelObjectPoolStats get_pool_stats() noexcept;
+#endif  // CONFIG_USERSPACE
+
+private:
+  // waits with the given kernel timeout, a timeout is not an error
+  [[nodiscard]] ZephyrBoolResult wait_timeout(std::unique_lock<Mutex>& lock, k_timeout_t timeout);
+  // returns the absolute time at which a timeout starting now expires
+  [[nodiscard]] static std::chrono::microseconds deadline_after(const std::chrono::milliseconds& timeout);
+
+#if CONFIG_USERSPACE
+  // index of the kernel object in the pool
+  size_t _pool_index = kInvalidPoolIndex;
+#else   // CONFIG_USERSPACE
+  struct k_condvar _condvar;
+#endif  // CONFIG_USERSPACE
+  struct k_condvar* _p_condvar = nullptr;
+#if CONFIG_ZPP_MUTEX_FUTEX
+  // sequence number incremented on each notification, allocated with the same pool index
+  struct k_futex* _p_futex = nullptr;
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
+};
+
+}  // namespace zpp_lib
@@ -31,10 +31,10 @@
 #include <zephyr/kernel.h>
 
 // std
-#include <functional>
 #include <string>
 
 // zpp_lib
+#include "zpp_include/inplace_function.hpp"
 #include "zpp_include/non_copyable.hpp"
 #include "zpp_include/zephyr_result.hpp"
 #include "zpp_include/zpp_assert.hpp"
@@ -164,8 +164,8 @@ private:
   uint32_t _background_color_value                                           = 0;
   uint8_t* _line_buffer                                                      = nullptr;
   const Font* _p_font                                                        = nullptr;
-  std::function<void(uint32_t, uint8_t*, size_t)> _fill_color_function       = nullptr;
-  std::function<void(const uint32_t*, size_t, uint8_t*)> _fill_line_function = nullptr;
+  InplaceFunction<void(uint32_t, uint8_t*, size_t)> _fill_color_function       = nullptr;
+  InplaceFunction<void(const uint32_t*, size_t, uint8_t*)> _fill_line_function = nullptr;
 };
 
 }  // namespace zpp_lib
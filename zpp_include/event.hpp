@@ -33,6 +33,7 @@
 #include <chrono>
 
 // zpp_lib
+#include "zpp_include/kernel_object_pool.hpp"
 #include "zpp_include/zephyr_result.hpp"
 
 namespace zpp_lib {
@@ -69,39 +70,93 @@ public:
   Event& operator=(const Event&) = delete;
   Event& operator=(Event&&)      = delete;
 
-  /** Set an event flag in the event object. This unblocks any thread
-   *  waiting on that flag.
+  /** Set event flags in the event object, the flags that are already set are kept.
+   *  This unblocks any thread waiting on these flags.
    *
    *  @note This function is ISR-safe.
    */
   void set(uint32_t event_flag);
 
+  /** Clear event flags in the event object.
+   *
+   *  @note This function is ISR-safe.
+   */
+  void clear(uint32_t events_flags);
+
   /** Wait indefinitely until one of the specified event flags is set.
    *  Up to 32 flags can be waited on simultaneously.
+   *  The matched flags are cleared atomically when the wait returns: flags set after
+   *  the wake-up, or that were not waited on, are kept for the next wait.
+   *  @return the matched flags, all of them are to be handled by the caller.
    *
    *  @note Cannot be called from ISR context.
    */
-  void wait_any(uint32_t events_flags) noexcept;
+  uint32_t wait_any(uint32_t events_flags) noexcept;
+
+  /** Wait indefinitely until all of the specified event flags are set.
+   *  The flags are cleared atomically when the wait returns.
+   *  @return the matched flags (events_flags).
+   *
+   *  @note Cannot be called from ISR context.
+   */
+  uint32_t wait_all(uint32_t events_flags) noexcept;
 
   /**
    * Wait timout until one of the specified event flags is set.
    * Up to 32 flags can be waited on simultaneously.
+   * The matched flags are cleared atomically when the wait returns.
    *
    * @note Cannot be called from ISR context.
    */
   [[nodiscard]] ZephyrBoolResult try_wait_any_for(const std::chrono::milliseconds& timeout, uint32_t events_flags) noexcept;
 
+  /**
+   * Same as try_wait_any_for(), matched_flags is set to the matched flags (0 on timeout).
+   */
+  [[nodiscard]] ZephyrBoolResult try_wait_any_for(const std::chrono::milliseconds& timeout,
+                                                  uint32_t events_flags,
+                                                  uint32_t& matched_flags) noexcept;
+
+  /**
+   * Wait timout until all of the specified event flags are set.
+   * The flags are cleared atomically when the wait returns.
+   *
+   * @note Cannot be called from ISR context.
+   */
+  [[nodiscard]] ZephyrBoolResult try_wait_all_for(const std::chrono::milliseconds& timeout, uint32_t events_flags) noexcept;
+
+  /** Wait indefinitely until one of the specified event flags is set, without clearing
+   *  the flags: all threads waiting on a flag are released when it is set, and the flag
+   *  stays set until clear() is called.
+   *  @return the matched flags.
+   *
+   *  @note Cannot be called from ISR context.
+   */
+  uint32_t wait_any_without_clear(uint32_t events_flags) noexcept;
+
 #if CONFIG_USERSPACE
   /**
    * Grants access to the k_event kernel object for a specific thread
    */
   void grant_access(k_tid_t tid);
+
+  /**
+   * Get the usage statistics of the pool of k_event kernel objects
+   */
+  [[nodiscard]] static KernelObjectPoolStats get_pool_stats() noexcept;
 #endif  // CONFIG_USERSPACE
 
 private:
-#if !CONFIG_USERSPACE
+  // waits for any or all flags, the matched flags are cleared atomically
+  [[nodiscard]] ZephyrBoolResult try_wait_for(k_timeout_t timeout, uint32_t events_flags, bool wait_all, uint32_t& matched_flags) noexcept;
+
+#if CONFIG_USERSPACE
+  friend class Thread;
+  // index of the kernel object in the pool, kInvalidPoolIndex if the object is not owned
+  size_t _pool_index = kInvalidPoolIndex;
+#else   // CONFIG_USERSPACE
   struct k_event _event;
-#endif  // !CONFIG_USERSPACE
+#endif  // CONFIG_USERSPACE
   struct k_event* _p_event = nullptr;
 };
 
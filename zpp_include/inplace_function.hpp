@@ -0,0 +1,175 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file inplace_function.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief C++ class implementing a callable wrapper with in-object storage
+ *        (std::function replacement that never allocates)
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// std
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// zpp_lib
+#include "zpp_include/zpp_assert.hpp"
+
+namespace zpp_lib {
+
+// default storage size of InplaceFunction, large enough for a member function
+// bound to an object or for a lambda capturing a few pointers
+inline constexpr size_t kInplaceFunctionDefaultCapacity = CONFIG_ZPP_INPLACE_FUNCTION_CAPACITY;
+
+template <typename Signature, size_t Capacity = kInplaceFunctionDefaultCapacity>
+class InplaceFunction;
+
+/** InplaceFunction is a drop-in replacement of std::function for the use cases of zpp_lib.
+ * The callable is stored within the object itself: InplaceFunction never allocates
+ * from the heap, and assigning a callable whose size exceeds Capacity bytes fails at
+ * compile time. An InplaceFunction can thus also be stored in a memory partition
+ * that is shared with user threads.
+ */
+template <typename R, typename... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+public:
+  static constexpr size_t kCapacity  = Capacity;
+  static constexpr size_t kAlignment = alignof(std::max_align_t);
+
+  constexpr InplaceFunction() noexcept = default;
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  constexpr InplaceFunction(std::nullptr_t) noexcept {}
+
+  // construct from any callable matching the signature (lambda, function pointer, functor)
+  template <typename F,
+            typename Callable = std::decay_t<F>,
+            typename          = std::enable_if_t<!std::is_same_v<Callable, InplaceFunction> &&
+                                                 std::is_invocable_r_v<R, Callable&, Args...>>>
+  // NOLINTNEXTLINE(google-explicit-constructor,bugprone-forwarding-reference-overload)
+  InplaceFunction(F&& f) noexcept(std::is_nothrow_constructible_v<Callable, F>) {
+    static_assert(sizeof(Callable) <= Capacity, "Callable is too large for this InplaceFunction, increase its capacity");
+    static_assert(alignof(Callable) <= kAlignment, "Callable alignment is not supported by InplaceFunction");
+    static_assert(std::is_copy_constructible_v<Callable>, "Callable must be copy constructible");
+    // an empty function pointer results in an empty InplaceFunction (as with std::function)
+    if constexpr (std::is_pointer_v<std::remove_reference_t<F>> || std::is_member_pointer_v<std::remove_reference_t<F>>) {
+      if (f == nullptr) {
+        return;
+      }
+    }
+    ::new (static_cast<void*>(&_storage)) Callable(std::forward<F>(f));
+    _p_ops = &kOps<Callable>;
+  }
+
+  InplaceFunction(const InplaceFunction& other) : _p_ops(other._p_ops) {
+    if (_p_ops != nullptr) {
+      _p_ops->copy(&_storage, &other._storage);
+    }
+  }
+
+  InplaceFunction(InplaceFunction&& other) noexcept : _p_ops(other._p_ops) {
+    if (_p_ops != nullptr) {
+      _p_ops->move(&_storage, &other._storage);
+      other.reset();
+    }
+  }
+
+  ~InplaceFunction() {
+    reset();
+  }
+
+  InplaceFunction& operator=(const InplaceFunction& other) {
+    if (this != &other) {
+      reset();
+      if (other._p_ops != nullptr) {
+        other._p_ops->copy(&_storage, &other._storage);
+        _p_ops = other._p_ops;
+      }
+    }
+    return *this;
+  }
+
+  InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+    if (this != &other) {
+      reset();
+      if (other._p_ops != nullptr) {
+        other._p_ops->move(&_storage, &other._storage);
+        _p_ops = other._p_ops;
+        other.reset();
+      }
+    }
+    return *this;
+  }
+
+  InplaceFunction& operator=(std::nullptr_t) noexcept {
+    reset();
+    return *this;
+  }
+
+  // invoke the callable, which must not be empty
+  R operator()(Args... args) const {
+    ZPP_ASSERT(_p_ops != nullptr, "Calling an empty InplaceFunction");
+    return _p_ops->invoke(&_storage, std::forward<Args>(args)...);
+  }
+
+  explicit operator bool() const noexcept {
+    return _p_ops != nullptr;
+  }
+
+  friend bool operator==(const InplaceFunction& f, std::nullptr_t) noexcept {
+    return f._p_ops == nullptr;
+  }
+
+private:
+  // type-erased operations on the stored callable
+  struct Ops {
+    R (*invoke)(void* p_storage, Args&&... args);
+    void (*copy)(void* p_dst, const void* p_src);
+    void (*move)(void* p_dst, void* p_src);
+    void (*destroy)(void* p_storage);
+  };
+
+  template <typename Callable>
+  static constexpr Ops kOps = {
+      [](void* p_storage, Args&&... args) -> R {
+        return std::invoke(*static_cast<Callable*>(p_storage), std::forward<Args>(args)...);
+      },
+      [](void* p_dst, const void* p_src) { ::new (p_dst) Callable(*static_cast<const Callable*>(p_src)); },
+      [](void* p_dst, void* p_src) { ::new (p_dst) Callable(std::move(*static_cast<Callable*>(p_src))); },
+      [](void* p_storage) { static_cast<Callable*>(p_storage)->~Callable(); },
+  };
+
+  void reset() noexcept {
+    if (_p_ops != nullptr) {
+      _p_ops->destroy(&_storage);
+      _p_ops = nullptr;
+    }
+  }
+
+  // the storage is mutable since invoking the callable may modify its state
+  // (as with std::function)
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+  alignas(kAlignment) mutable std::byte _storage[Capacity] = {};
+  const Ops* _p_ops                                        = nullptr;
+};
+
+}  // namespace zpp_lib
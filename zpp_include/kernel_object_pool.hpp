@@ -0,0 +1,158 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file kernel_object_pool.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Pool of statically allocated kernel objects used in user mode
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+// std
+#include <cstddef>
+#include <limits>
+
+namespace zpp_lib {
+
+// index of an object that was not allocated from a pool
+constexpr size_t kInvalidPoolIndex = std::numeric_limits<size_t>::max();
+
+// Usage statistics of a kernel object pool, as returned by KernelObjectPool::get_stats()
+struct KernelObjectPoolStats {
+  // number of objects in the pool
+  size_t size = 0;
+  // number of objects currently allocated
+  size_t nbr_of_used = 0;
+  // largest number of objects allocated at the same time
+  size_t max_nbr_of_used = 0;
+  // number of allocations that failed because the pool was exhausted
+  size_t nbr_of_failures = 0;
+};
+
+/** The KernelObjectPool class hands out kernel objects that are statically defined, as
+ required for objects used by user mode threads.
+ Allocation and release run in constant time for a given pool size and are lock-free:
+ the free objects are tracked with an atomic bitmap, and the wrapper class keeps the
+ index of its object for releasing it.
+
+ @note The pool must be located in a memory partition that is accessible by the user
+ mode threads creating objects (e.g. ZPP_LIB_DATA). It is initialized at compile time.
+*/
+template <typename T, size_t N> class KernelObjectPool {
+public:
+  // returns the kernel object at a given index
+  using object_getter_t = T* (*)(size_t index);
+
+  constexpr explicit KernelObjectPool(object_getter_t get_object) noexcept : _get_object(get_object) {}
+
+  /** Allocate an object from the pool
+    @param   index  index of the allocated object, to be given back to free().
+    @return  the allocated object, nullptr if the pool is exhausted (index is then
+             kInvalidPoolIndex).
+  */
+  [[nodiscard]] T* allocate(size_t& index) noexcept {
+    for (size_t word = 0; word < kNbrOfWords; word++) {
+      atomic_val_t busy = atomic_get(&_busy[word]);
+      // the loop only repeats if another thread allocated or freed an object concurrently
+      while (~busy != 0) {
+        // NOLINTNEXTLINE(google-runtime-int) -- type of atomic_val_t
+        auto bit = static_cast<size_t>(__builtin_ctzl(static_cast<unsigned long>(~busy)));
+        if (word * ATOMIC_BITS + bit >= N) {
+          break;
+        }
+        // NOLINTNEXTLINE(google-runtime-int) -- type of atomic_val_t
+        auto mask = static_cast<atomic_val_t>(static_cast<unsigned long>(1) << bit);
+        if (atomic_cas(&_busy[word], busy, busy | mask)) {
+          index = word * ATOMIC_BITS + bit;
+          update_stats_on_allocate();
+          return _get_object(index);
+        }
+        busy = atomic_get(&_busy[word]);
+      }
+    }
+    atomic_inc(&_nbr_of_failures);
+    index = kInvalidPoolIndex;
+    return nullptr;
+  }
+
+  /** Give an object back to the pool
+    @param   index  index returned by allocate().
+  */
+  void free(size_t index) noexcept {
+    if (index >= N) {
+      return;
+    }
+    if (atomic_test_and_clear_bit(_busy, static_cast<int>(index))) {
+      atomic_dec(&_nbr_of_used);
+    }
+  }
+
+  /** Get the object at a given index
+   */
+  [[nodiscard]] T* get(size_t index) const noexcept {
+    return index < N ? _get_object(index) : nullptr;
+  }
+
+  /** Get the index of an object of the pool, kInvalidPoolIndex if the object does not belong
+    to the pool. Unlike allocate() and free(), this search is linear.
+   */
+  [[nodiscard]] size_t index_of(const T* p_object) const noexcept {
+    for (size_t index = 0; index < N; index++) {
+      if (_get_object(index) == p_object) {
+        return index;
+      }
+    }
+    return kInvalidPoolIndex;
+  }
+
+  /** Get the usage statistics of the pool
+   */
+  [[nodiscard]] KernelObjectPoolStats get_stats() const noexcept {
+    KernelObjectPoolStats stats;
+    stats.size            = N;
+    stats.nbr_of_used     = static_cast<size_t>(atomic_get(&_nbr_of_used));
+    stats.max_nbr_of_used = static_cast<size_t>(atomic_get(&_max_nbr_of_used));
+    stats.nbr_of_failures = static_cast<size_t>(atomic_get(&_nbr_of_failures));
+    return stats;
+  }
+
+private:
+  static constexpr size_t kNbrOfWords = ATOMIC_BITMAP_SIZE(N);
+
+  void update_stats_on_allocate() noexcept {
+    atomic_val_t nbr_of_used     = atomic_inc(&_nbr_of_used) + 1;
+    atomic_val_t max_nbr_of_used = atomic_get(&_max_nbr_of_used);
+    while (nbr_of_used > max_nbr_of_used && !atomic_cas(&_max_nbr_of_used, max_nbr_of_used, nbr_of_used)) {
+      max_nbr_of_used = atomic_get(&_max_nbr_of_used);
+    }
+  }
+
+  object_getter_t _get_object;
+  // one bit per object, set when the object is allocated
+  atomic_t _busy[kNbrOfWords > 0 ? kNbrOfWords : 1] = {};
+  atomic_t _nbr_of_used                             = 0;
+  atomic_t _max_nbr_of_used                         = 0;
+  atomic_t _nbr_of_failures                         = 0;
+};
+
+}  // namespace zpp_lib
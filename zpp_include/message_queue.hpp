@@ -27,9 +27,19 @@
 // zephyr
 #include <zephyr/kernel.h>
 #include <zephyr/sys/clock.h>
+#if CONFIG_USERSPACE
+#include <zephyr/syscalls/msgq_syscalls.h>
+#endif  // CONFIG_USERSPACE
+
+// std
+#include <chrono>
+#include <cstddef>
+#include <span>
+#include <type_traits>
 
 // zpp_lib
 #include "zpp_include/clock.hpp"
+#include "zpp_include/kernel_object_pool.hpp"
 #include "zpp_include/non_copyable.hpp"
 #include "zpp_include/this_thread.hpp"
 #include "zpp_include/zephyr_result.hpp"
@@ -37,22 +47,21 @@
 namespace zpp_lib {
 
 #if CONFIG_USERSPACE
-extern uint8_t gMsgqInstanceCount;
-extern struct k_msgq ZPP_MESSAGE_QUEUE_ARRAY[CONFIG_ZPP_MSGQ_POOL_SIZE];
+using MessageQueuePool = KernelObjectPool<struct k_msgq, CONFIG_ZPP_MSGQ_POOL_SIZE>;
+extern MessageQueuePool gMsgqPool;
 #endif  // CONFIG_USERSPACE
 
 template <typename T, uint32_t QueueSize> class MessageQueue final : private NonCopyable {
+  // messages are copied with memcpy by the kernel, use Channel for other types
+  static_assert(std::is_trivially_copyable_v<T>, "MessageQueue messages must be trivially copyable");
+
 public:
 #if CONFIG_USERSPACE
   explicit MessageQueue(char* msgqBuffer) {
     // kernel objects are allocated statically
-    __ASSERT(
-        gMsgqInstanceCount < CONFIG_ZPP_MSGQ_POOL_SIZE, "Too many message queues created (pool size is %d)", CONFIG_ZPP_MSGQ_POOL_SIZE);
-
-    // update the thread instance count
-    k_msgq_init(&ZPP_MESSAGE_QUEUE_ARRAY[gMsgqInstanceCount], msgqBuffer, sizeof(T), QueueSize);
-    _p_msgq = &ZPP_MESSAGE_QUEUE_ARRAY[gMsgqInstanceCount];
-    gMsgqInstanceCount++;
+    _p_msgq = gMsgqPool.allocate(_pool_index);
+    __ASSERT(_p_msgq != nullptr, "Too many message queues created (pool size is %d)", CONFIG_ZPP_MSGQ_POOL_SIZE);
+    k_msgq_init(_p_msgq, msgqBuffer, sizeof(T), QueueSize);
 #else   // CONFIG_USERSPACE
   MessageQueue() {
     k_msgq_init(&_msgq, _msgq_buffer, sizeof(T), QueueSize);
@@ -60,6 +69,12 @@ public:
 #endif  // // CONFIG_USERSPACE
   }
 
+#if CONFIG_USERSPACE
+  ~MessageQueue() {
+    gMsgqPool.free(_pool_index);
+  }
+#endif  // CONFIG_USERSPACE
+
   [[nodiscard]] ZephyrBoolResult try_put_for(const std::chrono::microseconds& timeout, const T& data) {
     auto k_timeout = microseconds_to_ticks(timeout);
     auto ret       = k_msgq_put(_p_msgq, &data, k_timeout);
@@ -92,6 +107,52 @@ public:
     return res;
   }
 
+  /** Put up to data.size() messages in order, waiting until at least one can be put or a
+    timeout expires. A consumer woken up by the first message only runs once all messages
+    are put.
+    @param nbr_of_put set to the number of messages put.
+    @return true if at least one message was put, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_put_n_for(const std::chrono::microseconds& timeout, std::span<const T> data, size_t& nbr_of_put) {
+    auto k_timeout = microseconds_to_ticks(timeout);
+#if CONFIG_USERSPACE
+    // all messages are put in a single syscall
+    auto ret = msgq_syscall_put_n(_p_msgq, data.data(), static_cast<uint32_t>(data.size()), k_timeout);
+#else   // CONFIG_USERSPACE
+    auto ret = transfer_n(data.size(), k_timeout, [this, &data](size_t index, k_timeout_t transfer_timeout) {
+      return k_msgq_put(_p_msgq, &data[index], transfer_timeout);
+    });
+#endif  // CONFIG_USERSPACE
+    return make_batch_result(ret, k_timeout, nbr_of_put);
+  }
+
+  /** Get up to data.size() messages, waiting until at least one is available or a timeout
+    expires. A consumer thus wakes up once per burst of messages instead of once per message.
+    @param nbr_of_got set to the number of messages got.
+    @return true if at least one message was got, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_get_n_for(const std::chrono::microseconds& timeout, std::span<T> data, size_t& nbr_of_got) {
+    auto k_timeout = microseconds_to_ticks(timeout);
+#if CONFIG_USERSPACE
+    // all messages are got in a single syscall
+    auto ret = msgq_syscall_get_n(_p_msgq, data.data(), static_cast<uint32_t>(data.size()), k_timeout);
+#else   // CONFIG_USERSPACE
+    auto ret = transfer_n(data.size(), k_timeout, [this, &data](size_t index, k_timeout_t transfer_timeout) {
+      return k_msgq_get(_p_msgq, &data[index], transfer_timeout);
+    });
+#endif  // CONFIG_USERSPACE
+    return make_batch_result(ret, k_timeout, nbr_of_got);
+  }
+
+  /** Get all queued messages that fit in data, without waiting
+    @return the number of messages got.
+   */
+  size_t drain_into(std::span<T> data) {
+    size_t nbr_of_got = 0;
+    static_cast<void>(try_get_n_for(std::chrono::microseconds::zero(), data, nbr_of_got));
+    return nbr_of_got;
+  }
+
   uint32_t get_nbr_of_queued_messages() {
     return k_msgq_num_used_get(_p_msgq);
   }
@@ -100,10 +161,68 @@ public:
   void grant_access(k_tid_t tid) {
     k_object_access_grant(_p_msgq, tid);
   }
+
+  // usage statistics of the pool of k_msgq kernel objects, shared by all message queues
+  [[nodiscard]] static KernelObjectPoolStats get_pool_stats() noexcept {
+    return gMsgqPool.get_stats();
+  }
 #endif  // CONFIG_USERSPACE
 
 private:
+#if !CONFIG_USERSPACE
+  // transfers messages without waiting, with the scheduler locked so that a thread woken
+  // up by the first message only runs once the whole batch is transferred
+  template <typename F> static size_t transfer_no_wait(size_t first, size_t count, F transfer) {
+    bool lock  = !k_is_in_isr();
+    size_t nbr = first;
+    if (lock) {
+      k_sched_lock();
+    }
+    while (nbr < count && transfer(nbr, K_NO_WAIT) == 0) {
+      nbr++;
+    }
+    if (lock) {
+      k_sched_unlock();
+    }
+    return nbr - first;
+  }
+
+  // same behavior as msgq_syscall_put_n()/msgq_syscall_get_n() in user mode
+  template <typename F> static int transfer_n(size_t count, k_timeout_t timeout, F transfer) {
+    if (count == 0) {
+      return 0;
+    }
+    size_t nbr = transfer_no_wait(0, count, transfer);
+    if (nbr > 0 || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+      return nbr > 0 ? static_cast<int>(nbr) : -ENOMSG;
+    }
+    // wait for the first message, then transfer the others without waiting
+    auto ret = transfer(0, timeout);
+    if (ret != 0) {
+      return ret;
+    }
+    return static_cast<int>(1 + transfer_no_wait(1, count, transfer));
+  }
+#endif  // !CONFIG_USERSPACE
+
+  static ZephyrBoolResult make_batch_result(int ret, k_timeout_t k_timeout, size_t& nbr_of_messages) {
+    ZephyrBoolResult res;
+    nbr_of_messages = ret > 0 ? static_cast<size_t>(ret) : 0;
+    if (ret == 0 || (K_TIMEOUT_EQ(k_timeout, K_NO_WAIT) && ret == -ENOMSG) || (!K_TIMEOUT_EQ(k_timeout, K_NO_WAIT) && ret == -EAGAIN)) {
+      // no message or timeout -> return false without error
+      res.assign_value(false);
+    } else if (ret < 0) {
+      // other failure -> return false with error
+      __ASSERT(false, "Cannot transfer messages: %d", ret);
+      res.assign_value(false);
+      res.assign_error(zephyr_to_zpp_error_code(ret));
+    }
+    return res;
+  }
+
 #if CONFIG_USERSPACE
+  // index of the kernel object in the pool
+  size_t _pool_index = kInvalidPoolIndex;
 #else   // CONFIG_USERSPACE
   struct k_msgq _msgq;
   char _msgq_buffer[sizeof(T) * QueueSize];
@@ -0,0 +1,233 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file mpmc_queue.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Lock-free bounded multiple producers multiple consumers queue
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+// std
+#include <chrono>
+#include <cstddef>
+#include <type_traits>
+
+// zpp_lib
+#include "zpp_include/non_copyable.hpp"
+#include "zpp_include/semaphore.hpp"
+#include "zpp_include/types.hpp"
+#include "zpp_include/zephyr_result.hpp"
+
+namespace zpp_lib {
+
+/** The MpmcQueue class transfers items between any number of producers and consumers
+ running on different CPUs, without lock.
+ Each slot of the queue holds a sequence number telling whether it is free for the
+ producer or filled for the consumer of a given position. Producers and consumers claim
+ positions with a compare and swap on the tail and on the head, which are placed in
+ different cache lines. A producer and a consumer thus only contend on the slot they
+ exchange an item through.
+ Producers and consumers only enter the kernel, through a semaphore, when they wait for
+ a non-full or a non-empty queue, or when there is a waiting thread to wake up.
+
+ @note try_push and try_pop may be called from ISR context, they never block.
+ @note A producer preempted between claiming a slot and filling it delays the consumer
+ of that slot until it runs again, as with any sequence based bounded queue.
+*/
+template <typename T, size_t N> class MpmcQueue final : private NonCopyable {
+  static_assert(N > 1 && (N & (N - 1)) == 0, "MpmcQueue size must be a power of two greater than 1");
+  static_assert(std::is_trivially_copyable_v<T>, "MpmcQueue items must be trivially copyable");
+
+public:
+  MpmcQueue() noexcept {
+    for (size_t i = 0; i < N; i++) {
+      atomic_set(&_slots[i].sequence, static_cast<atomic_val_t>(i));
+    }
+  }
+
+  /** Push an item if the queue is not full
+    @return true if the item was pushed, false if the queue is full.
+   */
+  [[nodiscard]] bool try_push(const T& item) noexcept {
+    size_t position = load(_tail);
+    Slot* p_slot    = nullptr;
+    while (true) {
+      p_slot        = &_slots[position & kMask];
+      auto distance = static_cast<atomic_val_t>(load(p_slot->sequence) - position);
+      if (distance == 0) {
+        // the slot is free for this position, claim it
+        if (atomic_cas(&_tail, static_cast<atomic_val_t>(position), static_cast<atomic_val_t>(position + 1))) {
+          break;
+        }
+        position = load(_tail);
+      } else if (distance < 0) {
+        // the slot still holds the item pushed one round before
+        return false;
+      } else {
+        // another producer claimed this position
+        position = load(_tail);
+      }
+    }
+    p_slot->item = item;
+    atomic_set(&p_slot->sequence, static_cast<atomic_val_t>(position + 1));
+    wake_up(_nbr_of_waiting_consumers, _items_available);
+    return true;
+  }
+
+  /** Pop an item if the queue is not empty
+    @return true if an item was popped, false if the queue is empty.
+   */
+  [[nodiscard]] bool try_pop(T& item) noexcept {
+    size_t position = load(_head);
+    Slot* p_slot    = nullptr;
+    while (true) {
+      p_slot        = &_slots[position & kMask];
+      auto distance = static_cast<atomic_val_t>(load(p_slot->sequence) - (position + 1));
+      if (distance == 0) {
+        // the slot is filled for this position, claim it
+        if (atomic_cas(&_head, static_cast<atomic_val_t>(position), static_cast<atomic_val_t>(position + 1))) {
+          break;
+        }
+        position = load(_head);
+      } else if (distance < 0) {
+        // the slot is not filled yet
+        return false;
+      } else {
+        // another consumer claimed this position
+        position = load(_head);
+      }
+    }
+    item = p_slot->item;
+    // the slot becomes free for the position of the next round
+    atomic_set(&p_slot->sequence, static_cast<atomic_val_t>(position + N));
+    wake_up(_nbr_of_waiting_producers, _space_available);
+    return true;
+  }
+
+  /** Push an item, waiting until the queue is not full or a timeout expires
+    @return true if the item was pushed, false otherwise.
+
+    @note You cannot call this function from ISR context.
+   */
+  [[nodiscard]] ZephyrBoolResult try_push_for(const std::chrono::milliseconds& timeout, const T& item) {
+    return wait_for(timeout, _nbr_of_waiting_producers, _space_available, [this, &item]() { return try_push(item); });
+  }
+
+  /** Pop an item, waiting until one is available or a timeout expires
+    @return true if an item was popped, false otherwise.
+
+    @note You cannot call this function from ISR context.
+   */
+  [[nodiscard]] ZephyrBoolResult try_pop_for(const std::chrono::milliseconds& timeout, T& item) {
+    return wait_for(timeout, _nbr_of_waiting_consumers, _items_available, [this, &item]() { return try_pop(item); });
+  }
+
+  /** Get the number of items in the queue
+    @note The value is only a snapshot when other threads use the queue.
+   */
+  [[nodiscard]] size_t size() const noexcept {
+    size_t head = load(_head);
+    size_t tail = load(_tail);
+    // the head may pass a tail read before it
+    return tail - head > N ? 0 : tail - head;
+  }
+
+  [[nodiscard]] bool empty() const noexcept {
+    return size() == 0;
+  }
+
+  [[nodiscard]] static constexpr size_t capacity() noexcept {
+    return N;
+  }
+
+private:
+  static constexpr size_t kMask = N - 1;
+
+  struct Slot {
+    // position + 1 when filled, position when free for the producer of that position
+    atomic_t sequence;
+    T item;
+  };
+
+  static size_t load(const atomic_t& value) noexcept {
+    return static_cast<size_t>(atomic_get(&value));
+  }
+
+  // called after pushing or popping an item: a thread that registered itself as waiting
+  // before the item was published may have missed it, and must be woken up.
+  static void wake_up(const atomic_t& nbr_of_waiting, Semaphore& semaphore) noexcept {
+    if (atomic_get(&nbr_of_waiting) > 0) {
+      static_cast<void>(semaphore.release());
+    }
+  }
+
+  // calls operation until it succeeds, waiting on semaphore between attempts
+  template <typename F>
+  [[nodiscard]] static ZephyrBoolResult wait_for(const std::chrono::milliseconds& timeout,
+                                                 atomic_t& nbr_of_waiting,
+                                                 Semaphore& semaphore,
+                                                 F operation) {
+    ZephyrBoolResult res;
+    if (operation()) {
+      return res;
+    }
+    // wake-ups may be left from items that other threads already took, wait until the
+    // deadline
+    auto deadline = std::chrono::microseconds(k_ticks_to_us_floor64(k_uptime_ticks())) + timeout;
+    while (true) {
+      // register before trying again, so that the thread completing the operation sees
+      // the waiter
+      atomic_inc(&nbr_of_waiting);
+      if (operation()) {
+        atomic_dec(&nbr_of_waiting);
+        return res;
+      }
+      auto acquire_res = semaphore.try_acquire_until(deadline);
+      atomic_dec(&nbr_of_waiting);
+      if (acquire_res.has_error()) {
+        res.assign_error(acquire_res.error());
+        return res;
+      }
+      if (!acquire_res) {
+        // timeout, the operation may still have become possible in the meantime
+        res.assign_value(operation());
+        return res;
+      }
+    }
+  }
+
+  // free running positions, claimed by producers on the tail and by consumers on the head
+  alignas(kCacheLineSize) atomic_t _tail = ATOMIC_INIT(0);
+  alignas(kCacheLineSize) atomic_t _head = ATOMIC_INIT(0);
+  alignas(kCacheLineSize) Slot _slots[N] = {};
+  // number of threads waiting for an item or for a free slot
+  alignas(kCacheLineSize) atomic_t _nbr_of_waiting_consumers = ATOMIC_INIT(0);
+  atomic_t _nbr_of_waiting_producers                         = ATOMIC_INIT(0);
+  // released for each push or pop while a thread is waiting, the count keeps the wake-up
+  // when it races with a thread going to sleep
+  Semaphore _items_available{0, K_SEM_MAX_LIMIT};
+  Semaphore _space_available{0, K_SEM_MAX_LIMIT};
+};
+
+}  // namespace zpp_lib
@@ -31,15 +31,40 @@
 #include <chrono>
 
 // zpp_lib
+#include "zpp_include/kernel_object_pool.hpp"
 #include "zpp_include/zephyr_result.hpp"
 
 namespace zpp_lib {
 
+#if CONFIG_ZPP_MUTEX_STATS
+// Contention statistics of a mutex, as returned by Mutex::get_stats()
+// Only successful acquisitions are accounted for, a try_lock_for() that times out is not.
+// Without CONFIG_ZPP_MUTEX_FUTEX, the kernel reacquires the mutex at the end of a condition
+// variable wait, and that reacquisition is not accounted for either.
+struct MutexStats {
+  // name given to the mutex, nullptr if none
+  const char* name = nullptr;
+  // number of times the mutex was acquired
+  uint32_t nbr_of_acquisitions = 0;
+  // number of acquisitions for which the mutex was owned by another thread
+  uint32_t nbr_of_contended_acquisitions = 0;
+  // time spent waiting for the mutex in contended acquisitions
+  std::chrono::microseconds total_wait_time{0};
+  std::chrono::microseconds max_wait_time{0};
+  // longest time the mutex was held between its acquisition and its release
+  std::chrono::microseconds max_hold_time{0};
+  // name of the thread that owned the mutex during the longest wait
+  char worst_wait_owner[CONFIG_THREAD_MAX_NAME_LEN] = {0};
+};
+#endif  // CONFIG_ZPP_MUTEX_STATS
+
 /** The Mutex class is used to synchronize the execution of threads.
  This is, for example, used to protect access to a shared resource.
 
  @note You cannot use member functions of this class in ISR context. If you require Mutex
  functionality within ISR handler, consider using @a Semaphore.
+ @note With CONFIG_ZPP_MUTEX_FUTEX, the mutex is not recursive and does not implement
+ priority inheritance.
 */
 class Mutex final {
 public:
@@ -119,16 +144,69 @@ public:
    * Grants access to the k_mutex kernel object for a specific thread
    */
   void grant_access(k_tid_t tid);
+
+  /**
+   * Get the usage statistics of the pool of k_mutex kernel objects
+   */
+  [[nodiscard]] static KernelObjectPoolStats get_pool_stats() noexcept;
 #endif  // CONFIG_USERSPACE
 
+#if CONFIG_ZPP_MUTEX_STATS
+  /** Get the contention statistics of the mutex
+    @note The statistics are read without locking the mutex and may be slightly
+          inconsistent if the mutex is used concurrently.
+   */
+  [[nodiscard]] MutexStats get_stats() const noexcept;
+#endif  // CONFIG_ZPP_MUTEX_STATS
+
 private:
+  // waits on a condition variable with the kernel object of the mutex
+  friend class ConditionVariable;
+
+#if CONFIG_ZPP_MUTEX_STATS
+  // implementation of the public functions, without statistics
+  [[nodiscard]] ZephyrResult lock_impl();
+  [[nodiscard]] ZephyrBoolResult try_lock_for_impl(const std::chrono::milliseconds& timeout) noexcept;
+  [[nodiscard]] ZephyrResult unlock_impl();
+
+  // copies the name of the current owner of the mutex, before waiting for it
+  void copy_owner_name(char* owner_name, size_t size) const;
+  // updates the statistics after the mutex was acquired, owner_name is nullptr
+  // for an uncontended acquisition
+  void record_acquisition(uint32_t wait_start_cycles, const char* owner_name);
+  // records the current thread as owner, without counting an acquisition
+  void record_ownership(uint32_t now_cycles);
+  // updates the statistics before the mutex is released
+  void record_release();
+#endif  // CONFIG_ZPP_MUTEX_STATS
+
+
 #if CONFIG_USERSPACE
   friend class Thread;
-  static uint8_t _mutexInstanceCount;
+  // index of the kernel object in the pool, kInvalidPoolIndex if the object is not owned
+  size_t _pool_index = kInvalidPoolIndex;
 #else   // CONFIG_USERSPACE
   struct k_mutex _mutex;
 #endif  // CONFIG_USERSPACE
   struct k_mutex* _p_mutex = nullptr;
+#if CONFIG_ZPP_MUTEX_FUTEX
+  // futex word used instead of _p_mutex, allocated with the same pool index
+  struct k_futex* _p_futex = nullptr;
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
+#if CONFIG_ZPP_MUTEX_STATS
+  // statistics, written while the mutex is owned (durations in cycles)
+  const char* _name                       = nullptr;
+  k_tid_t _owner                          = nullptr;
+  uint32_t _lock_depth                    = 0;
+  uint32_t _acquire_cycles                = 0;
+  uint32_t _nbr_of_acquisitions           = 0;
+  uint32_t _nbr_of_contended_acquisitions = 0;
+  uint64_t _total_wait_cycles             = 0;
+  uint32_t _max_wait_cycles               = 0;
+  uint32_t _max_hold_cycles               = 0;
+  // name of the owner thread during the longest wait
+  char _worst_wait_owner[CONFIG_THREAD_MAX_NAME_LEN] = {0};
+#endif  // CONFIG_ZPP_MUTEX_STATS
 };
 
 }  // namespace zpp_lib
@@ -0,0 +1,178 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file periodic_thread.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief PeriodicThread class declaration
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// std
+#include <atomic>
+#include <chrono>
+
+// zpp_lib
+#include "zpp_include/inplace_function.hpp"
+#include "zpp_include/mutex.hpp"
+#include "zpp_include/non_copyable.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/types.hpp"
+#include "zpp_include/zephyr_result.hpp"
+
+namespace zpp_lib {
+
+// Statistics of a periodic thread, as returned by PeriodicThread::get_stats()
+// All durations are measured with the resolution of the kernel tick.
+struct PeriodicThreadStats {
+  // number of jobs executed
+  uint32_t nbr_of_releases = 0;
+  // number of jobs that completed after the next release time
+  uint32_t nbr_of_overruns = 0;
+  // delay between the release time and the start of the job
+  std::chrono::microseconds min_release_jitter{0};
+  std::chrono::microseconds max_release_jitter{0};
+  std::chrono::microseconds avg_release_jitter{0};
+  // delay between the release time and the completion of the job
+  std::chrono::microseconds min_response_time{0};
+  std::chrono::microseconds max_response_time{0};
+  std::chrono::microseconds avg_response_time{0};
+};
+
+/** The PeriodicThread class runs a job at a fixed period.
+ Jobs are released on absolute times (first release + n * period), so that the
+ execution time of a job does not make the following releases drift. When a job
+ overruns, the releases that were missed are skipped and the thread resumes on the
+ next release time.
+
+ @note As a Thread, a periodic thread can only be started once: it cannot be started
+ again after stop().
+*/
+class PeriodicThread final : private NonCopyable {
+public:
+  using job_function_t = InplaceFunction<void()>;
+
+  /** Allocate a new periodic thread without starting execution
+    @param   priority       priority of the thread.
+    @param   name           name to be used for this thread. It has to stay allocated
+    for the lifetime of the thread.
+    @param   period         period at which the job is released.
+#if CONFIG_USERSPACE
+    @param   userMode       flag stating whether the thread must be created in user mode
+#endif // CONFIG_USERSPACE
+    @param   stack_size     minimal stack size required by the thread.
+
+    @note You cannot call this function from ISR context.
+  */
+#if CONFIG_USERSPACE
+  PeriodicThread(PreemptableThreadPriority priority,
+                 const char* name,
+                 const std::chrono::microseconds& period,
+                 bool userMode,
+                 size_t stack_size = CONFIG_ZPP_THREAD_STACK_SIZE);
+  PeriodicThread(CooperativeThreadPriority priority,
+                 const char* name,
+                 const std::chrono::microseconds& period,
+                 bool userMode,
+                 size_t stack_size = CONFIG_ZPP_THREAD_STACK_SIZE);
+#else   // CONFIG_USERSPACE
+  PeriodicThread(PreemptableThreadPriority priority,
+                 const char* name,
+                 const std::chrono::microseconds& period,
+                 size_t stack_size = CONFIG_ZPP_THREAD_STACK_SIZE);
+  PeriodicThread(CooperativeThreadPriority priority,
+                 const char* name,
+                 const std::chrono::microseconds& period,
+                 size_t stack_size = CONFIG_ZPP_THREAD_STACK_SIZE);
+#endif  // CONFIG_USERSPACE
+
+  /** Stops the thread and waits for its termination
+   */
+  ~PeriodicThread();
+
+  /** Starts the thread, with a first release at the current time
+    @param   job            function to be executed at each release.
+    @return  status code that indicates the execution status of the function,
+             Inval if the period is not positive, Already if the thread was
+             already started (also if it was stopped since).
+  */
+  [[nodiscard]] ZephyrResult start(job_function_t job) noexcept;
+
+  /** Starts the thread, with a first release at a given absolute time
+    @param   job            function to be executed at each release.
+    @param   first_release  absolute time (system uptime) of the first release.
+    @return  status code that indicates the execution status of the function,
+             Inval if the period is not positive, Already if the thread was
+             already started (also if it was stopped since).
+  */
+  [[nodiscard]] ZephyrResult start(job_function_t job, const std::chrono::microseconds& first_release) noexcept;
+
+  /** Stops the thread after the current job and waits for its termination
+    @return  status code that indicates the execution status of the function.
+
+    @note A thread waiting for its next release is stopped at that release, so this
+          function may block for up to one period.
+  */
+  [[nodiscard]] ZephyrResult stop() noexcept;
+
+  /** Get the statistics of the thread, they may be read while the thread runs
+   */
+  [[nodiscard]] PeriodicThreadStats get_stats() const noexcept;
+
+  /** Get the release period of the thread
+   */
+  [[nodiscard]] std::chrono::microseconds get_period() const noexcept;
+
+private:
+  // loop executed by the thread
+  void run();
+
+  // updates the statistics after a job
+  void update_stats(int64_t release_ticks, int64_t start_ticks, int64_t end_ticks);
+
+  Thread _thread;
+  std::chrono::microseconds _period;
+  job_function_t _job;
+  int64_t _period_ticks       = 0;
+  int64_t _next_release_ticks = 0;
+  std::atomic<bool> _is_started{false};
+  std::atomic<bool> _is_stopped{false};
+  std::atomic<bool> _stop_requested{false};
+#if CONFIG_USERSPACE
+  bool _user_mode = false;
+  // set once a user mode thread was granted access to _stats_mutex
+  std::atomic<bool> _is_access_granted{false};
+#endif  // CONFIG_USERSPACE
+
+  // statistics, written by the thread and protected by _stats_mutex (in ticks)
+  mutable Mutex _stats_mutex;
+  uint32_t _nbr_of_releases   = 0;
+  uint32_t _nbr_of_overruns   = 0;
+  int64_t _min_jitter_ticks   = 0;
+  int64_t _max_jitter_ticks   = 0;
+  int64_t _sum_jitter_ticks   = 0;
+  int64_t _min_response_ticks = 0;
+  int64_t _max_response_ticks = 0;
+  int64_t _sum_response_ticks = 0;
+};
+
+}  // namespace zpp_lib
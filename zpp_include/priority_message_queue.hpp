@@ -0,0 +1,183 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file priority_message_queue.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief CPP class declaration/implementation of a message queue with priority levels
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/sys/clock.h>
+
+// std
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <type_traits>
+
+// zpp_lib
+#include "zpp_include/clock.hpp"
+#include "zpp_include/non_copyable.hpp"
+#include "zpp_include/spin_lock.hpp"
+#include "zpp_include/zephyr_result.hpp"
+
+namespace zpp_lib {
+
+/** The PriorityMessageQueue class is a message queue with NbrOfLevels priority levels,
+ each level holding up to QueueSize messages. Level 0 is the most urgent one, as for
+ thread priorities.
+ Messages are got from the most urgent non-empty level, in FIFO order within a level
+ (unless put with try_put_front_for()). The non-empty levels are kept in a bitmap, so
+ that getting a message does not depend on the number of levels or queued messages.
+ Since each level has its own capacity, urgent messages are never blocked by a full
+ backlog of less urgent messages.
+
+ @note Messages are copied in and out under a spin lock: put functions may be called
+       from ISR context with a zero timeout, but not from user mode threads.
+*/
+template <typename T, uint32_t QueueSize, uint8_t NbrOfLevels> class PriorityMessageQueue final : private NonCopyable {
+  static_assert(std::is_trivially_copyable_v<T>, "PriorityMessageQueue messages must be trivially copyable");
+  static_assert(QueueSize > 0, "PriorityMessageQueue size must be strictly positive");
+  static_assert(NbrOfLevels > 0 && NbrOfLevels <= 32, "PriorityMessageQueue supports 1 to 32 priority levels");
+
+public:
+  PriorityMessageQueue() {
+    k_sem_init(&_nbr_of_messages, 0, QueueSize * NbrOfLevels);
+    for (auto& level : _levels) {
+      k_sem_init(&level.nbr_of_free, QueueSize, QueueSize);
+    }
+  }
+
+  /** Put a message at the back of its priority level, waiting until the level is not
+    full or a timeout expires.
+    @return true if the message was put, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_put_for(const std::chrono::microseconds& timeout, const T& data, uint8_t priority) {
+    return put(timeout, data, priority, false);
+  }
+
+  /** Put a message at the front of its priority level, so that it is the next message
+    got from this level, waiting until the level is not full or a timeout expires.
+    @return true if the message was put, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_put_front_for(const std::chrono::microseconds& timeout, const T& data, uint8_t priority = 0) {
+    return put(timeout, data, priority, true);
+  }
+
+  /** Get the oldest message of the most urgent non-empty level, waiting until a message is
+    available or a timeout expires.
+    @return true if a message was got, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_get_for(const std::chrono::microseconds& timeout, T& data) {
+    uint8_t priority = 0;
+    return try_get_for(timeout, data, priority);
+  }
+
+  /** Same as try_get_for(timeout, data), priority is set to the level of the message got
+   */
+  [[nodiscard]] ZephyrBoolResult try_get_for(const std::chrono::microseconds& timeout, T& data, uint8_t& priority) {
+    auto res = take(&_nbr_of_messages, timeout);
+    if (res.has_error() || !res) {
+      return res;
+    }
+    {
+      std::scoped_lock<SpinLock> guard(_lock);
+      // a message is available, so at least one level is not empty
+      priority     = static_cast<uint8_t>(__builtin_ctz(_non_empty_levels));
+      Level& level = _levels[priority];
+      data         = level.buffer[level.head];
+      level.head   = (level.head + 1) % QueueSize;
+      level.count--;
+      if (level.count == 0) {
+        _non_empty_levels &= ~BIT(priority);
+      }
+    }
+    k_sem_give(&_levels[priority].nbr_of_free);
+    return res;
+  }
+
+  uint32_t get_nbr_of_queued_messages() {
+    return k_sem_count_get(&_nbr_of_messages);
+  }
+
+  uint32_t get_nbr_of_queued_messages(uint8_t priority) {
+    __ASSERT(priority < NbrOfLevels, "Invalid priority %d", priority);
+    std::scoped_lock<SpinLock> guard(_lock);
+    return _levels[priority].count;
+  }
+
+private:
+  struct Level {
+    std::array<T, QueueSize> buffer;
+    uint32_t head  = 0;
+    uint32_t count = 0;
+    // limits the number of messages in the level
+    struct k_sem nbr_of_free;
+  };
+
+  ZephyrBoolResult put(const std::chrono::microseconds& timeout, const T& data, uint8_t priority, bool at_front) {
+    __ASSERT(priority < NbrOfLevels, "Invalid priority %d", priority);
+    Level& level = _levels[priority];
+    auto res     = take(&level.nbr_of_free, timeout);
+    if (res.has_error() || !res) {
+      return res;
+    }
+    {
+      std::scoped_lock<SpinLock> guard(_lock);
+      if (at_front) {
+        level.head               = (level.head + QueueSize - 1) % QueueSize;
+        level.buffer[level.head] = data;
+      } else {
+        level.buffer[(level.head + level.count) % QueueSize] = data;
+      }
+      level.count++;
+      _non_empty_levels |= BIT(priority);
+    }
+    k_sem_give(&_nbr_of_messages);
+    return res;
+  }
+
+  static ZephyrBoolResult take(struct k_sem* p_sem, const std::chrono::microseconds& timeout) {
+    auto k_timeout = microseconds_to_ticks(timeout);
+    auto ret       = k_sem_take(p_sem, k_timeout);
+    ZephyrBoolResult res;
+    if ((K_TIMEOUT_EQ(k_timeout, K_NO_WAIT) && ret == -EBUSY) || (!K_TIMEOUT_EQ(k_timeout, K_NO_WAIT) && ret == -EAGAIN)) {
+      // timeout -> return false without error
+      res.assign_value(false);
+    } else if (ret != 0) {
+      // other failure -> return false with error
+      __ASSERT(false, "Cannot wait on priority message queue: %d (timeout is %lld usecs)", ret, timeout.count());
+      res.assign_value(false);
+      res.assign_error(zephyr_to_zpp_error_code(ret));
+    }
+    return res;
+  }
+
+  std::array<Level, NbrOfLevels> _levels;
+  // counts the messages in all levels
+  struct k_sem _nbr_of_messages;
+  // bit i is set when level i is not empty
+  uint32_t _non_empty_levels = 0;
+  SpinLock _lock;
+};  // NOLINT(readability/braces)
+
+}  // namespace zpp_lib
@@ -31,6 +31,7 @@
 #include <chrono>
 
 // zpp_lib
+#include "zpp_include/kernel_object_pool.hpp"
 #include "zpp_include/non_copyable.hpp"
 #include "zpp_include/zephyr_result.hpp"
 
@@ -71,6 +72,34 @@ public:
   */
   [[nodiscard]] ZephyrBoolResult try_acquire();
 
+  /** Wait until a Semaphore resource becomes available or a timeout expires.
+    @param   timeout  timeout value.
+    @return true if a resource was acquired, false otherwise.
+
+    @note You cannot call this function from ISR context.
+  */
+  [[nodiscard]] ZephyrBoolResult try_acquire_for(const std::chrono::milliseconds& timeout);
+
+  /** Wait until a Semaphore resource becomes available or an absolute time is reached.
+    @param   absolute_time  time since boot at which the wait expires.
+    @return true if a resource was acquired, false otherwise.
+
+    @note You cannot call this function from ISR context.
+  */
+  [[nodiscard]] ZephyrBoolResult try_acquire_until(const std::chrono::microseconds& absolute_time);
+
+  /** Wait until count Semaphore resources are acquired or a timeout expires.
+    @param   count    number of resources to acquire.
+    @param   timeout  timeout value for acquiring all resources.
+    @return true if all resources were acquired, false otherwise. On failure, the
+            resources acquired before the timeout expired are released.
+
+    @note The resources are acquired one by one: other threads may acquire resources
+    while the calling thread waits.
+    @note You cannot call this function from ISR context.
+  */
+  [[nodiscard]] ZephyrBoolResult acquire_n(uint32_t count, const std::chrono::milliseconds& timeout);
+
   /** Release a Semaphore resource that was obtain with Semaphore::acquire.
     @return status code that indicates the execution status of the function:
             @a osOK the token has been correctly released.
@@ -81,16 +110,34 @@ public:
   */
   [[nodiscard]] ZephyrResult release(void);
 
+  /** Release count Semaphore resources at once.
+    Waiting threads are made ready in a single pass: none of them runs before all
+    resources have been released. The count of the semaphore saturates at its maximum.
+    @param   count  number of resources to release.
+
+    @note You may call this function from ISR context.
+  */
+  [[nodiscard]] ZephyrResult release(uint32_t count);
+
 #if CONFIG_USERSPACE
   /**
    * Grants access to the k_mutex kernel object for a specific thread
    */
   void grant_access(k_tid_t tid);
+
+  /**
+   * Get the usage statistics of the pool of k_sem kernel objects
+   */
+  [[nodiscard]] static KernelObjectPoolStats get_pool_stats() noexcept;
 #endif  // CONFIG_USERSPACE
 
 private:
+  // take a resource with the given timeout, a timeout is not an error
+  ZephyrBoolResult take(k_timeout_t timeout);
+
 #if CONFIG_USERSPACE
-  static uint8_t _semaphoreInstanceCount;
+  // index of the kernel object in the pool
+  size_t _pool_index = kInvalidPoolIndex;
 #else   // CONFIG_USERSPACE
   struct k_sem _sem;
 #endif  // CONFIG_USERSPACE
@@ -0,0 +1,132 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file shared_mutex.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief SharedMutex class declaration
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// stl
+#include <chrono>
+
+// zpp_lib
+#include "zpp_include/mutex.hpp"
+#include "zpp_include/non_copyable.hpp"
+#include "zpp_include/semaphore.hpp"
+#include "zpp_include/zephyr_result.hpp"
+
+namespace zpp_lib {
+
+/** The SharedMutex class is a reader-writer lock: many threads may own it in shared mode
+ (readers), or a single thread may own it in exclusive mode (writer).
+ It can be used with std::unique_lock/std::scoped_lock for exclusive ownership and
+ with std::shared_lock for shared ownership.
+
+ Writers are preferred: once a writer waits for the mutex, new readers wait until all
+ waiting writers have released it. Ownership is handed over directly by the releasing
+ thread to the waiting threads.
+
+ @note The SharedMutex is built on a Mutex and two Semaphore instances. With CONFIG_USERSPACE,
+ these kernel objects are taken from the zpp_lib pools.
+ @note The SharedMutex is not recursive and does not implement priority inheritance.
+ @note You cannot use member functions of this class in ISR context.
+*/
+class SharedMutex final : private NonCopyable {
+public:
+  /** Create and Initialize a SharedMutex object
+   *
+   * @note You cannot call this function from ISR context.
+   */
+  SharedMutex() noexcept;
+
+  /** SharedMutex destructor
+   *
+   * @note You cannot call this function from ISR context.
+   */
+  ~SharedMutex() = default;
+
+  /** Wait until the mutex can be owned exclusively
+   */
+  [[nodiscard]] ZephyrResult lock();
+
+  /** Try to own the mutex exclusively, and return immediately
+    @return true if the mutex was acquired, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_lock() noexcept;
+
+  /** Try to own the mutex exclusively for a specified time
+    @param   timeout  timeout value.
+    @return true if the mutex was acquired, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_lock_for(const std::chrono::milliseconds& timeout) noexcept;
+
+  /** Release the exclusive ownership of the mutex
+   */
+  [[nodiscard]] ZephyrResult unlock();
+
+  /** Wait until the mutex can be owned in shared mode
+   */
+  [[nodiscard]] ZephyrResult lock_shared();
+
+  /** Try to own the mutex in shared mode, and return immediately
+    @return true if the mutex was acquired, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_lock_shared() noexcept;
+
+  /** Try to own the mutex in shared mode for a specified time
+    @param   timeout  timeout value.
+    @return true if the mutex was acquired, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_lock_shared_for(const std::chrono::milliseconds& timeout) noexcept;
+
+  /** Release the shared ownership of the mutex
+   */
+  [[nodiscard]] ZephyrResult unlock_shared();
+
+#if CONFIG_USERSPACE
+  /**
+   * Grants access to the kernel objects of the mutex for a specific thread
+   */
+  void grant_access(k_tid_t tid);
+#endif  // CONFIG_USERSPACE
+
+private:
+  // hands the mutex over to the waiting threads, if possible (called with _mutex locked)
+  void wake_up_waiters();
+
+  // protects the state below
+  Mutex _mutex;
+  // waiting readers and writers, released when the mutex is handed over to them
+  Semaphore _readers_semaphore;
+  Semaphore _writer_semaphore;
+  // number of readers owning the mutex
+  uint32_t _nbr_of_readers = 0;
+  // number of threads waiting for the mutex
+  uint32_t _nbr_of_waiting_readers = 0;
+  uint32_t _nbr_of_waiting_writers = 0;
+  // whether a writer owns the mutex
+  bool _is_writer_active = false;
+};
+
+}  // namespace zpp_lib
@@ -0,0 +1,117 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file spin_lock.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief CPP class declaration for wrapping zephyr os spin lock
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+// zpp_lib
+#include "zpp_include/non_copyable.hpp"
+
+namespace zpp_lib {
+
+/** The SpinLock class protects very short critical sections shared with ISRs.
+ Locking disables the local interrupts and, on SMP, spins until no other CPU owns the
+ lock. The thread owning the lock must neither block nor sleep.
+
+ The key that restores the interrupt state on unlock can be carried by a SpinLockGuard,
+ or it is stored in the lock itself when using lock()/unlock(), which makes the class
+ usable with std::scoped_lock and std::lock_guard. try_lock() is only available on SMP
+ targets.
+
+ @note You may use member functions of this class in ISR context.
+ @note You cannot use this class in user mode threads.
+*/
+class SpinLock final : private NonCopyable {
+public:
+  SpinLock() = default;
+
+  /** Lock the spin lock, the key is stored in the lock
+   */
+  void lock() noexcept {
+    k_spinlock_key_t key = k_spin_lock(&_lock);
+    // the key may only be stored once the lock is owned
+    _key = key;
+  }
+
+#if CONFIG_SMP
+  /** Try to lock the spin lock, and return immediately
+    @return true if the lock was acquired, false if another CPU owns it.
+
+    @note Only available on SMP targets: on a single CPU, the lock does not record its
+    owner and a nested attempt would succeed, overwriting the stored key. The lock must
+    not be owned by the calling thread.
+   */
+  [[nodiscard]] bool try_lock() noexcept {
+    k_spinlock_key_t key;
+    if (k_spin_trylock(&_lock, &key) != 0) {
+      return false;
+    }
+    _key = key;
+    return true;
+  }
+#endif  // CONFIG_SMP
+
+  /** Unlock the spin lock locked with lock() or try_lock()
+   */
+  void unlock() noexcept {
+    k_spin_unlock(&_lock, _key);
+  }
+
+  /** Lock the spin lock and return the key, to be given back to unlock(key)
+   */
+  [[nodiscard]] k_spinlock_key_t lock_with_key() noexcept {
+    return k_spin_lock(&_lock);
+  }
+
+  /** Unlock the spin lock locked with lock_with_key()
+   */
+  void unlock(k_spinlock_key_t key) noexcept {
+    k_spin_unlock(&_lock, key);
+  }
+
+private:
+  struct k_spinlock _lock = {};
+  k_spinlock_key_t _key   = {};
+};
+
+/** RAII guard owning a SpinLock for its lifetime, it carries the key of the lock
+ rather than storing it in the SpinLock.
+*/
+class SpinLockGuard final : private NonCopyable {
+public:
+  explicit SpinLockGuard(SpinLock& lock) noexcept : _lock(lock), _key(lock.lock_with_key()) {}
+
+  ~SpinLockGuard() {
+    _lock.unlock(_key);
+  }
+
+private:
+  SpinLock& _lock;
+  k_spinlock_key_t _key;
+};
+
+}  // namespace zpp_lib
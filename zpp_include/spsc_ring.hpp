@@ -0,0 +1,179 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file spsc_ring.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Lock-free single producer single consumer ring buffer
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+// std
+#include <chrono>
+#include <cstddef>
+#include <type_traits>
+
+// zpp_lib
+#include "zpp_include/non_copyable.hpp"
+#include "zpp_include/semaphore.hpp"
+#include "zpp_include/types.hpp"
+#include "zpp_include/zephyr_result.hpp"
+
+namespace zpp_lib {
+
+/** The SpscRing class transfers items from a single producer (e.g. an ISR) to a single
+ consumer thread without kernel operation per item.
+ The producer and the consumer each own one index of the ring, which are placed in
+ different cache lines. Pushing and popping items only requires atomic operations: the
+ consumer is only woken up, through a semaphore, when the ring becomes non-empty.
+
+ @note push functions may be called from ISR context, they never block.
+ @note Only one producer and one consumer may use the ring concurrently.
+*/
+template <typename T, size_t N> class SpscRing final : private NonCopyable {
+  static_assert(N > 0 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+  static_assert(std::is_trivially_copyable_v<T>, "SpscRing items must be trivially copyable");
+
+public:
+  SpscRing() noexcept = default;
+
+  /** Push an item if the ring is not full
+    @return true if the item was pushed, false if the ring is full.
+   */
+  [[nodiscard]] bool try_push(const T& item) noexcept {
+    return push_n(&item, 1) == 1;
+  }
+
+  /** Push up to count items, as many as the free space allows
+    @return the number of items pushed.
+   */
+  [[nodiscard]] size_t push_n(const T* items, size_t count) noexcept {
+    // the tail is only written by the producer
+    size_t tail          = load(_tail);
+    size_t nbr_of_pushed = min(count, N - (tail - load(_head)));
+    if (nbr_of_pushed == 0) {
+      return 0;
+    }
+    for (size_t i = 0; i < nbr_of_pushed; i++) {
+      _buffer[(tail + i) & kMask] = items[i];
+    }
+    atomic_set(&_tail, static_cast<atomic_val_t>(tail + nbr_of_pushed));
+    // the head is read after publishing the items: if the consumer had consumed all
+    // previous items, it may be waiting (or about to) and must be woken up. Otherwise,
+    // it sees the new items before waiting.
+    if (load(_head) == tail) {
+      static_cast<void>(_items_available.release());
+    }
+    return nbr_of_pushed;
+  }
+
+  /** Pop an item if the ring is not empty
+    @return true if an item was popped, false if the ring is empty.
+   */
+  [[nodiscard]] bool try_pop(T& item) noexcept {
+    return pop_n(&item, 1) == 1;
+  }
+
+  /** Pop up to max_count items, as many as available
+    @return the number of items popped.
+   */
+  [[nodiscard]] size_t pop_n(T* items, size_t max_count) noexcept {
+    // the head is only written by the consumer
+    size_t head          = load(_head);
+    size_t nbr_of_popped = min(max_count, load(_tail) - head);
+    for (size_t i = 0; i < nbr_of_popped; i++) {
+      items[i] = _buffer[(head + i) & kMask];
+    }
+    if (nbr_of_popped > 0) {
+      atomic_set(&_head, static_cast<atomic_val_t>(head + nbr_of_popped));
+    }
+    return nbr_of_popped;
+  }
+
+  /** Pop an item, waiting until one is available or a timeout expires
+    @return true if an item was popped, false otherwise.
+
+    @note You cannot call this function from ISR context.
+   */
+  [[nodiscard]] ZephyrBoolResult try_pop_for(const std::chrono::milliseconds& timeout, T& item) {
+    ZephyrBoolResult res;
+    res.assign_value(try_pop_n_for(timeout, &item, 1) == 1);
+    return res;
+  }
+
+  /** Pop up to max_count items, waiting until at least one is available or a timeout expires
+    @return the number of items popped, 0 if the timeout expired.
+
+    @note You cannot call this function from ISR context.
+   */
+  [[nodiscard]] size_t try_pop_n_for(const std::chrono::milliseconds& timeout, T* items, size_t max_count) {
+    size_t nbr_of_popped = pop_n(items, max_count);
+    if (nbr_of_popped > 0 || max_count == 0) {
+      return nbr_of_popped;
+    }
+    // a wake-up may be left from items that were already popped, wait until the deadline
+    auto deadline = std::chrono::microseconds(k_ticks_to_us_floor64(k_uptime_ticks())) + timeout;
+    while (nbr_of_popped == 0) {
+      auto res      = _items_available.try_acquire_until(deadline);
+      nbr_of_popped = pop_n(items, max_count);
+      if (res.has_error() || !res) {
+        break;
+      }
+    }
+    return nbr_of_popped;
+  }
+
+  /** Get the number of items in the ring
+   */
+  [[nodiscard]] size_t size() const noexcept {
+    return load(_tail) - load(_head);
+  }
+
+  [[nodiscard]] bool empty() const noexcept {
+    return size() == 0;
+  }
+
+  [[nodiscard]] static constexpr size_t capacity() noexcept {
+    return N;
+  }
+
+private:
+  static constexpr size_t kMask = N - 1;
+
+  static size_t load(const atomic_t& index) noexcept {
+    return static_cast<size_t>(atomic_get(&index));
+  }
+
+  static constexpr size_t min(size_t a, size_t b) noexcept {
+    return a < b ? a : b;
+  }
+
+  // free running indexes, the producer writes the tail and the consumer the head
+  alignas(kCacheLineSize) atomic_t _tail = ATOMIC_INIT(0);
+  alignas(kCacheLineSize) atomic_t _head = ATOMIC_INIT(0);
+  alignas(kCacheLineSize) T _buffer[N]   = {};
+  // released when the ring becomes non-empty
+  Semaphore _items_available{0, 1};
+};
+
+}  // namespace zpp_lib
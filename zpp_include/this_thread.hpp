@@ -27,6 +27,7 @@
 
 // stl
 #include <chrono>
+#include <cstdint>
 
 // zpp_lib
 #include "zpp_include/types.hpp"
@@ -40,12 +41,66 @@ namespace zpp_lib::ThisThread {
 ///
 void set_priority(PreemptableThreadPriority priority);
 
+///
+/// @brief Make the current thread cooperative with the given priority
+///
+/// @param thread priority
+///
+void set_priority(CooperativeThreadPriority priority);
+
+///
+/// @brief Check whether the current thread is a cooperative thread
+///
+///
+bool is_cooperative();
+
 ///
 /// @brief Get the current thread priority
 ///
 ///
 PreemptableThreadPriority get_priority();
 
+///
+/// @brief Get the index of the CPU running the current thread
+///
+/// @note The value may be outdated as soon as it is returned, unless the thread is
+///       pinned to a CPU. Always 0 on non SMP targets.
+/// @note You cannot call this function from a user mode thread.
+///
+uint8_t get_cpu();
+
+#if CONFIG_SCHED_CPU_MASK
+///
+/// @brief Get the CPUs on which the current thread may run (bit n for CPU n)
+///
+/// @note Zephyr only allows modifying the mask of threads that are not running:
+///       see Thread::set_cpu_mask() and Thread::pin_to_cpu().
+/// @note You cannot call this function from a user mode thread.
+///
+uint32_t get_cpu_mask();
+#endif  // CONFIG_SCHED_CPU_MASK
+
+#if CONFIG_SCHED_DEADLINE
+///
+/// @brief Set the deadline of the current thread, relative to the current time
+///
+/// @note Deadlines only order threads of the same priority (earliest deadline first).
+///
+void set_deadline(const std::chrono::microseconds& deadline);
+
+///
+/// @brief Set the deadline of the next job of a periodic thread and suspend the
+///        current thread until the job release time
+///
+/// @param release_time The absolute release time of the next job
+/// @param relative_deadline The deadline of the job, relative to its release time
+///
+/// @note The deadline is set before sleeping, so that jobs released at the same
+///       time are ordered by their deadline when they become ready.
+///
+std::chrono::milliseconds release_at(const std::chrono::microseconds& release_time, const std::chrono::microseconds& relative_deadline);
+#endif  // CONFIG_SCHED_DEADLINE
+
 ///
 ///
 /// @brief Perform a busy wait on the current thread
@@ -27,17 +27,37 @@
 #include <zephyr/kernel.h>
 
 // std
-#include <functional>
+#include <chrono>
 #include <string>
 
 // zpp_lib
 #include "zpp_include/event.hpp"
+#include "zpp_include/inplace_function.hpp"
 #include "zpp_include/mutex.hpp"
 #include "zpp_include/types.hpp"
 #include "zpp_include/zephyr_result.hpp"
 
 namespace zpp_lib {
 
+#if CONFIG_ZPP_THREAD_STATS
+// Runtime statistics of a thread, as returned by Thread::get_stats()
+struct ThreadStats {
+  // cycles spent running the thread
+  uint64_t execution_cycles = 0;
+  // longest and average number of cycles run each time the thread was scheduled
+  uint64_t peak_cycles    = 0;
+  uint64_t average_cycles = 0;
+  // number of times the thread was scheduled
+  uint32_t nbr_of_schedules = 0;
+  // stack size and maximal stack usage (in bytes)
+  size_t stack_size           = 0;
+  size_t stack_high_watermark = 0;
+  // time spent running and time spent waiting (blocked or ready) since the thread was started
+  std::chrono::microseconds running_time{0};
+  std::chrono::microseconds waiting_time{0};
+};
+#endif  // CONFIG_ZPP_THREAD_STATS
+
 class Thread final {
 public:
   /** Allocate a new thread without starting execution
@@ -48,13 +68,36 @@ public:
 #if CONFIG_USERSPACE
     @param   userMode       flag stating whether the thread must be created in user mode
 #endif // CONFIG_USERSPACE
+    @param   stack_size     minimal stack size required by the thread. The stack is taken
+    from the smallest pre-allocated stack size class that fits (see ZPP_THREAD_STACK_SIZE and
+    ZPP_THREAD_STACK_*_POOL_SIZE). (default: CONFIG_ZPP_THREAD_STACK_SIZE)
+
+    @note You cannot call this function from ISR context.
+  */
+#if CONFIG_USERSPACE
+  explicit Thread(PreemptableThreadPriority priority,
+                  const char* name,
+                  bool userMode,
+                  size_t stack_size = CONFIG_ZPP_THREAD_STACK_SIZE);
+#else   // CONFIG_USERSPACE
+  explicit Thread(PreemptableThreadPriority priority, const char* name, size_t stack_size = CONFIG_ZPP_THREAD_STACK_SIZE);
+#endif  // CONFIG_USERSPACE
+
+  /** Allocate a new cooperative thread without starting execution
+    @param   priority       cooperative priority of the thread function. The thread is
+    never preempted by other threads and runs until it blocks, sleeps or yields.
+
+    The other parameters are the same as for preemptable threads.
 
     @note You cannot call this function from ISR context.
   */
 #if CONFIG_USERSPACE
-  explicit Thread(PreemptableThreadPriority priority, const char* name, bool userMode);
+  explicit Thread(CooperativeThreadPriority priority,
+                  const char* name,
+                  bool userMode,
+                  size_t stack_size = CONFIG_ZPP_THREAD_STACK_SIZE);
 #else   // CONFIG_USERSPACE
-  explicit Thread(PreemptableThreadPriority priority, const char* name);
+  explicit Thread(CooperativeThreadPriority priority, const char* name, size_t stack_size = CONFIG_ZPP_THREAD_STACK_SIZE);
 #endif  // CONFIG_USERSPACE
 
   /** Performs sanity checks
@@ -78,7 +121,7 @@ public:
 
     @note You cannot call this function ISR context.
   */
-  using task_function_t = std::function<void()>;
+  using task_function_t = InplaceFunction<void()>;
   [[nodiscard]] ZephyrResult start(task_function_t task) noexcept;
 
   /** Wait for thread to have started
@@ -95,26 +138,120 @@ public:
   */
   [[nodiscard]] ZephyrResult join() noexcept;
 
+#if CONFIG_USERSPACE
+  /** Get the thread id (nullptr if the thread is not started)
+   */
+  [[nodiscard]] k_tid_t get_tid() const noexcept;
+#endif  // CONFIG_USERSPACE
+
+#if CONFIG_ZPP_THREAD_STATS
+  /** Get the runtime statistics of the thread
+    @param   stats          statistics of the thread.
+    @return  status code that indicates the execution status of the function,
+             Srch if the thread is not started or already joined.
+
+    @note Zephyr does not distinguish the time spent blocked from the time spent ready:
+          both are reported as waiting time.
+    @note You cannot call this function from a user mode thread.
+  */
+  [[nodiscard]] ZephyrResult get_stats(ThreadStats& stats) const noexcept;
+#endif  // CONFIG_ZPP_THREAD_STATS
+
+#if CONFIG_SCHED_DEADLINE
+  /** Set the deadline of the thread, for earliest deadline first scheduling
+    @param   deadline       deadline relative to the current time or, if the thread
+    is not started yet, relative to the time at which it is started.
+    @return  status code that indicates the execution status of the function,
+             Inval if the deadline is not positive or too large.
+
+    @note Deadlines only order threads of the same priority: among ready threads
+          of equal priority, the one with the earliest deadline runs first.
+    @note The deadline is not re-armed by the kernel: periodic threads should
+          use ThisThread::release_at() for setting a deadline at each release.
+    @note You cannot call this function from ISR context.
+  */
+  [[nodiscard]] ZephyrResult set_deadline(const std::chrono::microseconds& deadline) noexcept;
+#endif  // CONFIG_SCHED_DEADLINE
+
+#if CONFIG_SCHED_CPU_MASK
+  // mask allowing the thread to run on all CPUs (default)
+  static constexpr uint32_t kAllCpusMask = (1U << CONFIG_MP_MAX_NUM_CPUS) - 1U;
+
+  /** Set the CPUs on which the thread may run
+    @param   cpu_mask       bit mask of the allowed CPUs (bit n for CPU n).
+    @return  status code that indicates the execution status of the function,
+             Inval if the mask is empty or contains non existing CPUs,
+             Already if the thread is already started.
+
+    @note The mask is applied when the thread is started: it must be set before start().
+    @note With CONFIG_SCHED_CPU_MASK_PIN_ONLY, the mask must contain a single CPU.
+    @note A thread with a CPU mask must be started from a supervisor thread.
+    @note You cannot call this function from ISR context.
+  */
+  [[nodiscard]] ZephyrResult set_cpu_mask(uint32_t cpu_mask) noexcept;
+
+  /** Pin the thread to a single CPU (equivalent to set_cpu_mask(BIT(cpu)))
+    @param   cpu            index of the CPU the thread must run on.
+    @return  status code that indicates the execution status of the function.
+
+    @note You cannot call this function from ISR context.
+  */
+  [[nodiscard]] ZephyrResult pin_to_cpu(uint8_t cpu) noexcept;
+
+  /** Get the CPUs on which the thread may run
+   */
+  [[nodiscard]] uint32_t get_cpu_mask() const noexcept;
+#endif  // CONFIG_SCHED_CPU_MASK
+
+  // value of the slot index when no k_thread/stack pair is used
+  static constexpr uint8_t kNoSlot = UINT8_MAX;
+
 private:
   // Required to share definitions without
   // delegated constructors
   static void s_thunk(void* p1, void* p2, void* p3);
 
+  // releases the k_thread/stack pair once the thread is joined
+  void release_slot() noexcept;
+
+  // common constructor for preemptable and cooperative threads
+#if CONFIG_USERSPACE
+  Thread(int zephyr_priority, const char* name, bool userMode, size_t stack_size);
+#else   // CONFIG_USERSPACE
+  Thread(int zephyr_priority, const char* name, size_t stack_size);
+#endif  // CONFIG_USERSPACE
+
   Mutex _mutex;
   Event _event;
+  // Zephyr priority, negative for cooperative threads
+  int _priority;
+  std::string _name;
 #if CONFIG_USERSPACE
   bool _userMode = false;
 #else   // CONFIG_USERSPACE
   Thread::task_function_t _task;
 #endif  // CONFIG_USERSPACE
 
-  PreemptableThreadPriority _priority;
   static constexpr uint32_t kStartedEvent = 0x01;
-  std::string _name;
+  size_t _stack_size;
   k_tid_t _tid = nullptr;
 
-  // used for accessing the corresponding statically allocated stack
-  static uint8_t s_thread_instance_count;
+  // index of the statically allocated k_thread and stack used by this thread
+  uint8_t _slot = kNoSlot;
+
+#if CONFIG_SCHED_CPU_MASK
+  uint32_t _cpu_mask = kAllCpusMask;
+#endif  // CONFIG_SCHED_CPU_MASK
+
+#if CONFIG_SCHED_DEADLINE
+  // deadline applied when the thread is started (0 if none)
+  std::chrono::microseconds _deadline{0};
+#endif  // CONFIG_SCHED_DEADLINE
+
+#if CONFIG_ZPP_THREAD_STATS
+  // uptime at which the thread was started
+  int64_t _start_ticks = 0;
+#endif  // CONFIG_ZPP_THREAD_STATS
 };
 
 }  // namespace zpp_lib
@@ -0,0 +1,389 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file thread_pool.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief C++ class implementing a work-stealing pool of worker threads
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+// std
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// zpp_lib
+#include "zpp_include/clock.hpp"
+#include "zpp_include/inplace_function.hpp"
+#include "zpp_include/non_copyable.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/types.hpp"
+#include "zpp_include/zephyr_result.hpp"
+#include "zpp_include/zpp_assert.hpp"
+
+namespace zpp_lib {
+
+/** ThreadPool runs short jobs on NbrOfWorkers worker threads.
+ *
+ * Each worker owns a deque of jobs. Jobs submitted from a worker are pushed to its
+ * own deque, while jobs submitted from other threads are pushed to a bounded global
+ * injection queue. An idle worker first pops the last job of its own deque, then
+ * the oldest job of the injection queue and finally steals the oldest job of the
+ * other workers' deques.
+ *
+ * At most QueueSize jobs may be pending or running at any time: submit() blocks
+ * until a job slot becomes available, try_submit_for() gives up after a timeout.
+ *
+ * @note The worker threads run in supervisor mode, and the pool must be shared
+ *       only among supervisor threads. Each worker uses one of the pre-allocated
+ *       zpp_lib thread stacks (see CONFIG_ZPP_THREAD_POOL_SIZE). Job handles must
+ *       not outlive the pool.
+ */
+template <size_t NbrOfWorkers, size_t QueueSize>
+class ThreadPool final : private NonCopyable {
+  static_assert(NbrOfWorkers > 0, "ThreadPool requires at least one worker");
+  static_assert(QueueSize > 0 && QueueSize < UINT16_MAX, "Invalid ThreadPool queue size");
+
+public:
+  using Job = InplaceFunction<void()>;
+
+  /** Handle for waiting on the completion of a submitted job. A handle is move only,
+   * and destroying a handle does not wait for or cancel the job.
+   */
+  class JobHandle {
+  public:
+    JobHandle() noexcept = default;
+    ~JobHandle() {
+      reset();
+    }
+
+    JobHandle(JobHandle&& other) noexcept : _p_pool(other._p_pool), _slot(other._slot), _is_done(other._is_done) {
+      other._p_pool = nullptr;
+    }
+    JobHandle& operator=(JobHandle&& other) noexcept {
+      if (this != &other) {
+        reset();
+        _p_pool       = other._p_pool;
+        _slot         = other._slot;
+        _is_done      = other._is_done;
+        other._p_pool = nullptr;
+      }
+      return *this;
+    }
+    JobHandle(const JobHandle&)            = delete;
+    JobHandle& operator=(const JobHandle&) = delete;
+
+    // returns false if the job could not be submitted
+    [[nodiscard]] bool is_valid() const noexcept {
+      return _p_pool != nullptr;
+    }
+
+    // wait until the job has been executed
+    [[nodiscard]] ZephyrResult wait() noexcept {
+      ZephyrResult res;
+      auto wait_res = wait_for_ticks(K_FOREVER);
+      if (wait_res.has_error()) {
+        res.assign_error(wait_res.error());
+      }
+      return res;
+    }
+
+    // wait until the job has been executed or until the timeout expires
+    // returns true if the job was executed
+    [[nodiscard]] ZephyrBoolResult try_wait_for(const std::chrono::milliseconds& timeout) noexcept {
+      return wait_for_ticks(milliseconds_to_ticks(timeout));
+    }
+
+  private:
+    friend class ThreadPool;
+    JobHandle(ThreadPool* p_pool, uint16_t slot) noexcept : _p_pool(p_pool), _slot(slot) {}
+
+    ZephyrBoolResult wait_for_ticks(k_timeout_t timeout) noexcept {
+      ZephyrBoolResult res;
+      if (_p_pool == nullptr) {
+        res.assign_error(ZephyrErrorCode::Inval);
+        return res;
+      }
+      if (!_is_done) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        auto ret = k_sem_take(&_p_pool->_slots[_slot].done, timeout);
+        if (ret == -EAGAIN || ret == -EBUSY) {
+          res.assign_value(false);
+          return res;
+        }
+        if (ret != 0) {
+          ZPP_ASSERT(false, "Cannot wait for job: %d", ret);
+          res.assign_error(zephyr_to_zpp_error_code(ret));
+          return res;
+        }
+        _is_done = true;
+      }
+      res.assign_value(true);
+      return res;
+    }
+
+    void reset() noexcept {
+      if (_p_pool != nullptr) {
+        _p_pool->release_slot(_slot);
+        _p_pool = nullptr;
+      }
+    }
+
+    ThreadPool* _p_pool = nullptr;
+    uint16_t _slot      = 0;
+    bool _is_done       = false;
+  };
+
+  explicit ThreadPool(const char* name,
+                      PreemptableThreadPriority priority = PreemptableThreadPriority::PriorityNormal,
+                      size_t stack_size                  = CONFIG_ZPP_THREAD_STACK_SIZE)
+      : _workers(make_workers(name, priority, stack_size, std::make_index_sequence<NbrOfWorkers>{})) {
+    k_sem_init(&_free_slots, QueueSize, QueueSize);
+    k_sem_init(&_queued_jobs, 0, K_SEM_MAX_LIMIT);
+    for (auto& slot : _slots) {
+      k_sem_init(&slot.done, 0, 1);
+    }
+    for (size_t index = 0; index < NbrOfWorkers; index++) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      auto res = _workers[index].start([this, index]() { this->run_worker(index); });
+      if (!res) {
+        ZPP_ASSERT(false, "Could not start ThreadPool worker %zu: %d", index, static_cast<int>(res.error()));
+      }
+    }
+    for (auto& worker : _workers) {
+      worker.wait_started();
+    }
+  }
+
+  // executes all pending jobs and stops the workers
+  ~ThreadPool() {
+    _is_stopping.store(true);
+    for (size_t index = 0; index < NbrOfWorkers; index++) {
+      k_sem_give(&_queued_jobs);
+    }
+    for (auto& worker : _workers) {
+      auto res = worker.join();
+      if (!res) {
+        ZPP_ASSERT(false, "Could not join ThreadPool worker: %d", static_cast<int>(res.error()));
+      }
+    }
+  }
+
+  // submit a job, waiting for a job slot if QueueSize jobs are already pending
+  [[nodiscard]] JobHandle submit(Job job) noexcept {
+    return submit_for_ticks(std::move(job), K_FOREVER);
+  }
+
+  // submit a job, waiting at most timeout for a job slot
+  // the returned handle is invalid if no job slot became available
+  [[nodiscard]] JobHandle try_submit_for(Job job, const std::chrono::milliseconds& timeout) noexcept {
+    return submit_for_ticks(std::move(job), milliseconds_to_ticks(timeout));
+  }
+
+  // number of jobs that are queued and not yet picked up by a worker
+  [[nodiscard]] uint32_t get_nbr_of_pending_jobs() const noexcept {
+    return _nbr_of_pending_jobs.load();
+  }
+
+  // number of jobs that were picked up from another worker's deque
+  [[nodiscard]] uint32_t get_nbr_of_stolen_jobs() const noexcept {
+    return _nbr_of_stolen_jobs.load();
+  }
+
+private:
+  // Slot holding a submitted job. A slot is referenced by the pool while the job is
+  // pending or running, and by the job handle. It is freed once both released it.
+  struct JobSlot {
+    Job job;
+    struct k_sem done;
+    std::atomic<uint8_t> nbr_of_refs = 0;
+  };
+
+  // Bounded ring of slot indices protected by a spin lock. As there are never more
+  // than QueueSize jobs, a ring can never overflow.
+  class SlotRing {
+  public:
+    void push_back(uint16_t slot) noexcept {
+      k_spinlock_key_t key = k_spin_lock(&_lock);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      _slots[(_head + _size) % QueueSize] = slot;
+      _size++;
+      k_spin_unlock(&_lock, key);
+    }
+
+    bool pop_back(uint16_t& slot) noexcept {
+      k_spinlock_key_t key = k_spin_lock(&_lock);
+      bool found           = _size > 0;
+      if (found) {
+        _size--;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        slot = _slots[(_head + _size) % QueueSize];
+      }
+      k_spin_unlock(&_lock, key);
+      return found;
+    }
+
+    bool pop_front(uint16_t& slot) noexcept {
+      k_spinlock_key_t key = k_spin_lock(&_lock);
+      bool found           = _size > 0;
+      if (found) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        slot  = _slots[_head];
+        _head = (_head + 1) % QueueSize;
+        _size--;
+      }
+      k_spin_unlock(&_lock, key);
+      return found;
+    }
+
+  private:
+    struct k_spinlock _lock = {};
+    std::array<uint16_t, QueueSize> _slots{};
+    size_t _head = 0;
+    size_t _size = 0;
+  };
+
+  template <size_t... Indexes>
+  static std::array<Thread, NbrOfWorkers> make_workers(const char* name,
+                                                       PreemptableThreadPriority priority,
+                                                       size_t stack_size,
+                                                       std::index_sequence<Indexes...> /*unused*/) {
+#if CONFIG_USERSPACE
+    return {{(static_cast<void>(Indexes), Thread(priority, name, false, stack_size))...}};
+#else   // CONFIG_USERSPACE
+    return {{(static_cast<void>(Indexes), Thread(priority, name, stack_size))...}};
+#endif  // CONFIG_USERSPACE
+  }
+
+  JobHandle submit_for_ticks(Job job, k_timeout_t timeout) noexcept {
+    if (_is_stopping.load() || k_sem_take(&_free_slots, timeout) != 0) {
+      return JobHandle();
+    }
+    // a free slot is guaranteed to exist after taking the semaphore
+    uint16_t slot = 0;
+    while (atomic_test_and_set_bit(_busy_slots, slot)) {
+      slot = (slot + 1) % QueueSize;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    JobSlot& job_slot = _slots[slot];
+    job_slot.job      = std::move(job);
+    k_sem_reset(&job_slot.done);
+    // one reference for the pool and one for the handle
+    job_slot.nbr_of_refs.store(2);
+
+    // jobs submitted from a worker go to its own deque
+    _nbr_of_pending_jobs++;
+    size_t worker_index = current_worker_index();
+    if (worker_index < NbrOfWorkers) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      _deques[worker_index].push_back(slot);
+    } else {
+      _injection_queue.push_back(slot);
+    }
+    k_sem_give(&_queued_jobs);
+    return JobHandle(this, slot);
+  }
+
+  // returns the index of the calling worker, NbrOfWorkers if not called from a worker
+  size_t current_worker_index() const noexcept {
+    k_tid_t tid = k_current_get();
+    for (size_t index = 0; index < NbrOfWorkers; index++) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      if (_worker_tids[index].load() == tid) {
+        return index;
+      }
+    }
+    return NbrOfWorkers;
+  }
+
+  bool pop_job(size_t worker_index, uint16_t& slot) noexcept {
+    // own deque first (most recently pushed job), then injection queue
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    if (_deques[worker_index].pop_back(slot) || _injection_queue.pop_front(slot)) {
+      return true;
+    }
+    // steal the oldest job of another worker
+    for (size_t offset = 1; offset < NbrOfWorkers; offset++) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      if (_deques[(worker_index + offset) % NbrOfWorkers].pop_front(slot)) {
+        _nbr_of_stolen_jobs++;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void run_worker(size_t worker_index) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    _worker_tids[worker_index].store(k_current_get());
+    while (true) {
+      // each queued job gives the semaphore once, each stopped worker as well
+      k_sem_take(&_queued_jobs, K_FOREVER);
+      uint16_t slot = 0;
+      // a queued job is guaranteed to exist, but it may be pushed to a deque that
+      // was already visited: retry until it is found
+      while (!pop_job(worker_index, slot)) {
+        if (_is_stopping.load() && _nbr_of_pending_jobs.load() == 0) {
+          return;
+        }
+        k_yield();
+      }
+      _nbr_of_pending_jobs--;
+
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      JobSlot& job_slot = _slots[slot];
+      job_slot.job();
+      job_slot.job = nullptr;
+      k_sem_give(&job_slot.done);
+      release_slot(slot);
+    }
+  }
+
+  void release_slot(uint16_t slot) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    if (_slots[slot].nbr_of_refs.fetch_sub(1) == 1) {
+      atomic_clear_bit(_busy_slots, slot);
+      k_sem_give(&_free_slots);
+    }
+  }
+
+  std::array<JobSlot, QueueSize> _slots;
+  ATOMIC_DEFINE(_busy_slots, QueueSize) = {};
+  struct k_sem _free_slots  = {};
+  struct k_sem _queued_jobs = {};
+  SlotRing _injection_queue;
+  std::array<SlotRing, NbrOfWorkers> _deques;
+  std::array<std::atomic<k_tid_t>, NbrOfWorkers> _worker_tids{};
+  std::atomic<uint32_t> _nbr_of_pending_jobs = 0;
+  std::atomic<uint32_t> _nbr_of_stolen_jobs  = 0;
+  std::atomic<bool> _is_stopping             = false;
+  // the workers are declared last, so that they are started after and joined before
+  // the destruction of the other members
+  std::array<Thread, NbrOfWorkers> _workers;
+};
+
+}  // namespace zpp_lib
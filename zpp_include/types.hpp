@@ -24,6 +24,10 @@
 
 #pragma once
 
+// std
+#include <cstddef>
+#include <cstdint>
+
 namespace zpp_lib {
 
 // we expect CONFIG_NUM_PREEMPT_PRIORITIES to be at least 10
@@ -31,6 +35,11 @@ namespace zpp_lib {
 #error zpp_lib requires CONFIG_NUM_PREEMPT_PRIORITIES >= 10
 #endif
 
+// we expect CONFIG_NUM_COOP_PRIORITIES to be at least 4
+#if CONFIG_NUM_COOP_PRIORITIES < 4
+#error zpp_lib requires CONFIG_NUM_COOP_PRIORITIES >= 4
+#endif
+
 // Preemptable thread priority values
 enum class PreemptableThreadPriority : int8_t {
   PriorityIdle        = CONFIG_NUM_PREEMPT_PRIORITIES - 1,  ///< Reserved for Idle thread
@@ -46,6 +55,26 @@ enum class PreemptableThreadPriority : int8_t {
                                                         ///< deferred thread)
 };
 
+// Cooperative thread priority values (negative Zephyr priorities)
+// A cooperative thread is never preempted by another thread: it runs until it blocks,
+// sleeps or yields. Data shared only among cooperative threads thus needs no locking
+// on single CPU targets. On SMP targets, cooperative threads still run concurrently
+// on other CPUs.
+enum class CooperativeThreadPriority : int8_t {
+  PriorityLow      = -1,  ///< Lowest cooperative priority, higher than any preemptable priority
+  PriorityNormal   = -2,
+  PriorityHigh     = -3,
+  PriorityRealtime = -4
+};
+
+// Size of a data cache line, used for placing data written by different CPUs in different
+// lines. Targets without data cache use the most common line size.
+#if defined(CONFIG_DCACHE_LINE_SIZE) && CONFIG_DCACHE_LINE_SIZE > 0
+inline constexpr size_t kCacheLineSize = CONFIG_DCACHE_LINE_SIZE;
+#else   // defined(CONFIG_DCACHE_LINE_SIZE) && CONFIG_DCACHE_LINE_SIZE > 0
+inline constexpr size_t kCacheLineSize = 64;
+#endif  // defined(CONFIG_DCACHE_LINE_SIZE) && CONFIG_DCACHE_LINE_SIZE > 0
+
 constexpr PreemptableThreadPriority prio_to_preemptable_thread_priority(int prio) noexcept {
   return static_cast<PreemptableThreadPriority>(prio);
 }
@@ -54,4 +83,8 @@ constexpr int preemptable_thread_priority_to_zephyr_prio(PreemptableThreadPriori
   return static_cast<int>(prio);
 }
 
+constexpr int cooperative_thread_priority_to_zephyr_prio(CooperativeThreadPriority prio) noexcept {
+  return static_cast<int>(prio);
+}
+
 }  // namespace zpp_lib
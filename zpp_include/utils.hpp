@@ -24,6 +24,11 @@
 
 #pragma once
 
+#if CONFIG_ZPP_MUTEX_STATS
+// zpp_lib
+#include "zpp_include/mutex.hpp"
+#endif  // CONFIG_ZPP_MUTEX_STATS
+
 namespace zpp_lib {
 
 class Utils {
@@ -38,6 +43,12 @@ public:
   static void log_heap_summary();
 #endif
   static void log_cpu_load();
+#if CONFIG_ZPP_MUTEX_STATS
+  static void log_mutex_stats(const Mutex& mutex);
+#endif  // CONFIG_ZPP_MUTEX_STATS
+#if CONFIG_USERSPACE
+  static void log_kernel_object_pools();
+#endif  // CONFIG_USERSPACE
 };
 
 }  // namespace zpp_lib
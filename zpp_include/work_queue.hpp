@@ -55,16 +55,18 @@ public:
 #else   // CONFIG_USERSPACE
   explicit WorkQueue(const char* name, zpp_lib::PreemptableThreadPriority threadPriority) : _name(name), _thread(threadPriority, name) {
 #endif  // CONFIG_USERSPACE
-    k_work_queue_init(&_work_queue);
-
-    // start the _isrWorkQueueThread thread
-    auto res = _thread.start([this]() { this->run(); });
-    if (!res) {
-      ZPP_ASSERT(false, "Could not start WorkQueue thread: %d", (int)res.error());
-    }
+    start_thread();
+  }
 
-    // wait for the thread to be started
-    _thread.wait_started();
+  // constructor for running the work queue from an internal cooperative thread:
+  // work items are never preempted by other threads and run to completion
+#if CONFIG_USERSPACE
+  explicit WorkQueue(const char* name, zpp_lib::CooperativeThreadPriority threadPriority, bool userMode)
+      : _name(name), _thread(threadPriority, name, userMode) {
+#else   // CONFIG_USERSPACE
+  explicit WorkQueue(const char* name, zpp_lib::CooperativeThreadPriority threadPriority) : _name(name), _thread(threadPriority, name) {
+#endif  // CONFIG_USERSPACE
+    start_thread();
   }
 
   void run() {
@@ -134,6 +136,19 @@ public:
   }
 
 private:
+  void start_thread() {
+    k_work_queue_init(&_work_queue);
+
+    // start the _isrWorkQueueThread thread
+    auto res = _thread.start([this]() { this->run(); });
+    if (!res) {
+      ZPP_ASSERT(false, "Could not start WorkQueue thread: %d", (int)res.error());
+    }
+
+    // wait for the thread to be started
+    _thread.wait_started();
+  }
+
   struct k_work_q _work_queue = {};
   std::string _name;
   zpp_lib::Thread _thread;
@@ -0,0 +1,211 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file zero_copy_message_queue.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief CPP class declaration/implementation of a message queue passing pooled
+ *        buffers instead of copying messages
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/sys/clock.h>
+
+// std
+#include <chrono>
+#include <cstddef>
+#include <new>
+
+// zpp_lib
+#include "zpp_include/clock.hpp"
+#include "zpp_include/non_copyable.hpp"
+#include "zpp_include/zephyr_result.hpp"
+
+namespace zpp_lib {
+
+/** The ZeroCopyMessageQueue class transfers messages of type T without copying them.
+ The producer allocates a message from a pool of NbrOfBlocks blocks (k_mem_slab), fills
+ it in place and puts it in the queue, which only transfers a pointer to the block. The
+ consumer gets the message as a Message handle, that returns the block to the pool when
+ it is reset or destroyed.
+
+ @note The pool of blocks is not a kernel object that can be granted to user threads:
+       the queue may only be used from supervisor threads (or from ISR with K_NO_WAIT).
+ @note Message handles must not outlive the queue that allocated them.
+*/
+template <typename T, uint32_t QueueSize, uint32_t NbrOfBlocks = QueueSize> class ZeroCopyMessageQueue final : private NonCopyable {
+public:
+  /** The Message class owns a block allocated from a ZeroCopyMessageQueue
+   */
+  class Message final {
+  public:
+    Message() noexcept = default;
+
+    Message(Message&& other) noexcept : _p_slab(other._p_slab), _p_data(other._p_data) {
+      other._p_data = nullptr;
+    }
+
+    Message& operator=(Message&& other) noexcept {
+      if (this != &other) {
+        reset();
+        _p_slab       = other._p_slab;
+        _p_data       = other._p_data;
+        other._p_data = nullptr;
+      }
+      return *this;
+    }
+
+    Message(const Message&)            = delete;
+    Message& operator=(const Message&) = delete;
+
+    ~Message() {
+      reset();
+    }
+
+    /** Return the block to the pool of the queue, if any
+     */
+    void reset() noexcept {
+      if (_p_data != nullptr) {
+        _p_data->~T();
+        k_mem_slab_free(_p_slab, _p_data);
+        _p_data = nullptr;
+      }
+    }
+
+    [[nodiscard]] T* get() const noexcept {
+      return _p_data;
+    }
+
+    T& operator*() const noexcept {
+      return *_p_data;
+    }
+
+    T* operator->() const noexcept {
+      return _p_data;
+    }
+
+    explicit operator bool() const noexcept {
+      return _p_data != nullptr;
+    }
+
+  private:
+    friend class ZeroCopyMessageQueue;
+
+    Message(struct k_mem_slab* p_slab, T* p_data) noexcept : _p_slab(p_slab), _p_data(p_data) {}
+
+    struct k_mem_slab* _p_slab = nullptr;
+    T* _p_data                 = nullptr;
+  };
+
+  ZeroCopyMessageQueue() {
+    k_msgq_init(&_msgq, _msgq_buffer, sizeof(T*), QueueSize);
+    [[maybe_unused]] auto ret = k_mem_slab_init(&_slab, _slab_buffer, kBlockSize, NbrOfBlocks);
+    __ASSERT(ret == 0, "Cannot initialize message pool: %d", ret);
+  }
+
+  ~ZeroCopyMessageQueue() {
+    // destroy the messages still in the queue, the blocks go away with the pool
+    T* p_data = nullptr;
+    while (k_msgq_get(&_msgq, static_cast<void*>(&p_data), K_NO_WAIT) == 0) {
+      p_data->~T();
+    }
+  }
+
+  /** Allocate a message from the pool, waiting until a block is free or a timeout expires.
+    The message is value initialized.
+    @return true if a message was allocated, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_allocate_for(const std::chrono::microseconds& timeout, Message& message) {
+    auto k_timeout = microseconds_to_ticks(timeout);
+    void* p_block  = nullptr;
+    auto ret       = k_mem_slab_alloc(&_slab, &p_block, k_timeout);
+    auto res       = make_result(ret, k_timeout, -ENOMEM);
+    if (ret == 0) {
+      message = Message(&_slab, new (p_block) T());
+    }
+    return res;
+  }
+
+  /** Put a message allocated from this queue, without copying it. On success, the
+    ownership of the message is transferred to the queue and message is left empty.
+    @return true if the message was put, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_put_for(const std::chrono::microseconds& timeout, Message& message) {
+    __ASSERT(message._p_slab == &_slab && message._p_data != nullptr, "Cannot put a message not allocated from this queue");
+    auto k_timeout = microseconds_to_ticks(timeout);
+    T* p_data      = message._p_data;
+    auto ret       = k_msgq_put(&_msgq, static_cast<const void*>(&p_data), k_timeout);
+    auto res       = make_result(ret, k_timeout, -ENOMSG);
+    if (ret == 0) {
+      message._p_data = nullptr;
+    }
+    return res;
+  }
+
+  /** Get a message, waiting until one is available or a timeout expires. On success,
+    message owns the received block (the block it previously owned is returned to the pool).
+    @return true if a message was received, false otherwise.
+   */
+  [[nodiscard]] ZephyrBoolResult try_get_for(const std::chrono::microseconds& timeout, Message& message) {
+    auto k_timeout = microseconds_to_ticks(timeout);
+    T* p_data      = nullptr;
+    auto ret       = k_msgq_get(&_msgq, static_cast<void*>(&p_data), k_timeout);
+    auto res       = make_result(ret, k_timeout, -ENOMSG);
+    if (ret == 0) {
+      message = Message(&_slab, p_data);
+    }
+    return res;
+  }
+
+  uint32_t get_nbr_of_queued_messages() {
+    return k_msgq_num_used_get(&_msgq);
+  }
+
+  uint32_t get_nbr_of_free_blocks() {
+    return k_mem_slab_num_free_get(&_slab);
+  }
+
+private:
+  // blocks must be aligned on and be a multiple of the pointer size
+  static constexpr size_t kBlockAlignment = alignof(T) > sizeof(void*) ? alignof(T) : sizeof(void*);
+  static constexpr size_t kBlockSize      = (sizeof(T) + kBlockAlignment - 1) / kBlockAlignment * kBlockAlignment;
+
+  static ZephyrBoolResult make_result(int ret, k_timeout_t k_timeout, int no_wait_ret) {
+    ZephyrBoolResult res;
+    if ((K_TIMEOUT_EQ(k_timeout, K_NO_WAIT) && ret == no_wait_ret) || (!K_TIMEOUT_EQ(k_timeout, K_NO_WAIT) && ret == -EAGAIN)) {
+      // timeout -> return false without error
+      res.assign_value(false);
+    } else if (ret != 0) {
+      // other failure -> return false with error
+      __ASSERT(false, "Zero copy message queue operation failed: %d", ret);
+      res.assign_value(false);
+      res.assign_error(zephyr_to_zpp_error_code(ret));
+    }
+    return res;
+  }
+
+  struct k_msgq _msgq;
+  struct k_mem_slab _slab;
+  char _msgq_buffer[sizeof(T*) * QueueSize];
+  alignas(kBlockAlignment) char _slab_buffer[kBlockSize * NbrOfBlocks];
+};  // NOLINT(readability/braces)
+
+}  // namespace zpp_lib
@@ -13,7 +13,7 @@
 // limitations under the License.
 
 /****************************************************************************
- * @file mutex.cpp
+ * @file barrier.cpp
  * @author Serge Ayer <serge.ayer@hefr.ch>
  *
  * @brief Barrier class implementation
@@ -24,6 +24,9 @@
 
 #include "zpp_include/barrier.hpp"
 
+// std
+#include <utility>
+
 // zephyr
 #if CONFIG_USERSPACE
 #include <zephyr/app_memory/app_memdomain.h>
@@ -50,60 +53,93 @@ extern struct k_mem_partition zpp_lib_partition;
 
 namespace zpp_lib {
 
-using std::literals::chrono_literals::operator""us;
-ZPP_LIB_DATA std::chrono::microseconds Barrier::_start_time = 0us;
+namespace {
+
+// event flag released at the end of a phase. Consecutive phases use different flags, so
+// that the flag of the next phase can be cleared while the waiters of the current phase
+// are being woken up.
+constexpr uint32_t phase_flag(uint32_t generation) {
+  return BIT(generation & 1U);
+}
 
-Barrier::Barrier(uint32_t nbr_of_threads) : _wait_semaphore{0, nbr_of_threads}, _count(nbr_of_threads), _total(nbr_of_threads) {}
+}  // namespace
+
+Barrier::Barrier(uint32_t nbr_of_threads, CompletionFunction completion)
+    : _completion(std::move(completion)), _count(nbr_of_threads), _total(nbr_of_threads) {
+  ZPP_ASSERT(nbr_of_threads > 0, "A barrier requires at least one thread");
+}
 
 #if CONFIG_TEST
 std::chrono::microseconds Barrier::wait(const Barrier::ZeroTimeCB& zero_time_cb) {
-#else
-std::chrono::microseconds Barrier::wait() {
+  return wait_phase(zero_time_cb);
+}
 #endif
+
+std::chrono::microseconds Barrier::wait() {
+  return wait_phase(nullptr);
+}
+
+uint32_t Barrier::get_generation() {
+  auto res = _mutex.lock();
+  if (!res) {
+    ZPP_ASSERT(false, "Cannot lock mutex: %d", static_cast<int>(res.error()));
+  }
+  uint32_t generation = _generation;
+  res                 = _mutex.unlock();
+  if (!res) {
+    ZPP_ASSERT(false, "Cannot unlock mutex: %d", static_cast<int>(res.error()));
+  }
+  return generation;
+}
+
+std::chrono::microseconds Barrier::wait_phase(const CompletionFunction& zero_time_cb) {
   auto res = _mutex.lock();
   if (!res) {
     ZPP_ASSERT(false, "Cannot lock mutex: %d", static_cast<int>(res.error()));
   }
+  uint32_t generation = _generation;
   _count--;
   if (_count == 0) {
     // Last thread to arrive — get start time and release all
     _start_time = zpp_lib::Time::get_uptime();
 
-#if CONFIG_TEST
-    zero_time_cb(_start_time);
-#endif
+    if (zero_time_cb) {
+      zero_time_cb(_start_time);
+    }
+    if (_completion) {
+      _completion(_start_time);
+    }
 
 #if CONFIG_SEGGER_SYSTEMVIEW
 #define SYSVIEW_MARK_TIME_ZERO 255U
     SEGGER_SYSVIEW_Mark(SYSVIEW_MARK_TIME_ZERO);
 #endif  // CONFIG_SEGGER_SYSTEMVIEW
 
-    for (uint32_t i = 0; i < _total; i++) {
-      res = _wait_semaphore.release();
-      if (!res) {
-        ZPP_ASSERT(false, "Cannot release semaphore: %d", static_cast<int>(res.error()));
-      }
-    }
+    // start the next phase: its threads cannot wait before the mutex is unlocked, and
+    // the threads of this phase are released with a single event broadcast
+    _count = _total;
+    _generation++;
+    _event.clear(phase_flag(_generation));
+    _event.set(phase_flag(generation));
   }
   res = _mutex.unlock();
   if (!res) {
     ZPP_ASSERT(false, "Cannot unlock mutex: %d", static_cast<int>(res.error()));
   }
 
-  res = _wait_semaphore.acquire();
-  if (!res) {
-    ZPP_ASSERT(false, "Cannot acquire semaphore: %d", static_cast<int>(res.error()));
-  }
+  // the flag stays set until the end of the next phase, which cannot complete before
+  // all threads of this phase returned
+  _event.wait_any_without_clear(phase_flag(generation));
 
-  // _start_time is the same value for all threads
+  // _start_time is the same value for all threads of the phase
   return _start_time;
 }
 
 #if CONFIG_USERSPACE
 void Barrier::grant_access(k_tid_t tid) {
-  // Grant access to the internal semaphore and mutex attributes
+  // Grant access to the internal event and mutex attributes
   ZPP_LOG_DBG("Granting access to barrier for thread %p", static_cast<void*>(tid));
-  _wait_semaphore.grant_access(tid);
+  _event.grant_access(tid);
   _mutex.grant_access(tid);
 }
 #endif  // CONFIG_USERSPACE
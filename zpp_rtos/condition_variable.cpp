@@ -0,0 +1,203 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file condition_variable.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief ConditionVariable class implementation
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "zpp_include/condition_variable.hpp"
+
+// zephyr
+#if CONFIG_USERSPACE
+#include <zephyr/app_memory/app_memdomain.h>
+#endif  // CONFIG_USERSPACE
+
+// zpp_lib
+#include "zpp_include/clock.hpp"
+#include "zpp_include/kernel_object_pool.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_log.hpp"
+
+ZPP_LOG_MODULE_DECLARE(zpp_rtos, CONFIG_ZPP_RTOS_LOG_LEVEL);
+
+#if CONFIG_USERSPACE
+extern struct k_mem_partition zpp_lib_partition;
+#define ZPP_LIB_DATA K_APP_DMEM(zpp_lib_partition)
+#define ZPP_LIB_BSS K_APP_BMEM(zpp_lib_partition)
+#else  // CONFIG_USERSPACE
+#define ZPP_LIB_DATA
+#define ZPP_LIB_BSS
+#endif  // CONFIG_USERSPACE
+
+namespace zpp_lib {
+
+#if CONFIG_USERSPACE
+// the k_condvar array must be initialized in global memory (not application domain)
+static struct k_condvar ZPP_CONDVAR_ARRAY[CONFIG_ZPP_CONDVAR_POOL_SIZE] = {};
+
+using ConditionVariablePool = KernelObjectPool<struct k_condvar, CONFIG_ZPP_CONDVAR_POOL_SIZE>;
+ZPP_LIB_DATA static ConditionVariablePool s_condvar_pool([](size_t index) { return &ZPP_CONDVAR_ARRAY[index]; });
+#endif  // CONFIG_USERSPACE
+
+#if CONFIG_ZPP_MUTEX_FUTEX
+// sequence numbers live in the zpp_lib partition, as the futex words of the mutexes.
+// The k_condvar objects are then only used for their pool index.
+ZPP_LIB_BSS static struct k_futex ZPP_CONDVAR_FUTEX_ARRAY[CONFIG_ZPP_CONDVAR_POOL_SIZE];
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
+
+// False positive, _condvar is initialized with k_condvar_init
+// NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+ConditionVariable::ConditionVariable() noexcept {
+#if CONFIG_USERSPACE
+  // kernel objects are allocated statically
+  _p_condvar = s_condvar_pool.allocate(_pool_index);
+  ZPP_ASSERT(_p_condvar != nullptr, "Too many condition variables created (pool size is %d)", CONFIG_ZPP_CONDVAR_POOL_SIZE);
+#if CONFIG_ZPP_MUTEX_FUTEX
+  _p_futex = &ZPP_CONDVAR_FUTEX_ARRAY[_pool_index];
+  atomic_set(&_p_futex->val, 0);
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
+  ZPP_LOG_DBG("Condition variable %p allocated (instance index %d, total %d)",
+              static_cast<void*>(_p_condvar),
+              _pool_index,
+              s_condvar_pool.get_stats().nbr_of_used);
+#else   // CONFIG_USERSPACE
+  _p_condvar = &_condvar;
+#endif  // CONFIG_USERSPACE
+  ZPP_ASSERT_EVAL(k_condvar_init(_p_condvar),
+                  auto ret = k_condvar_init(_p_condvar),
+                  ret == 0,
+                  "Cannot create condition variable: %d",
+                  ret);
+}
+
+ConditionVariable::~ConditionVariable() {
+#if CONFIG_USERSPACE
+  s_condvar_pool.free(_pool_index);
+  ZPP_LOG_DBG("Condition variable %p freed (instance index %d, total %d)",
+              static_cast<void*>(_p_condvar),
+              _pool_index,
+              s_condvar_pool.get_stats().nbr_of_used);
+#endif  // CONFIG_USERSPACE
+}
+
+ZephyrResult ConditionVariable::wait(std::unique_lock<Mutex>& lock) {
+  ZephyrResult res;
+  auto bool_res = wait_timeout(lock, K_FOREVER);
+  if (bool_res.has_error()) {
+    res.assign_error(bool_res.error());
+  }
+  return res;
+}
+
+ZephyrBoolResult ConditionVariable::wait_for(std::unique_lock<Mutex>& lock, const std::chrono::milliseconds& timeout) {
+  return wait_timeout(lock, milliseconds_to_ticks(timeout));
+}
+
+ZephyrBoolResult ConditionVariable::wait_until(std::unique_lock<Mutex>& lock, const std::chrono::microseconds& absolute_time) {
+  return wait_timeout(lock, K_TIMEOUT_ABS_US(absolute_time.count()));
+}
+
+ZephyrBoolResult ConditionVariable::wait_timeout(std::unique_lock<Mutex>& lock, k_timeout_t timeout) {
+  ZPP_ASSERT(lock.owns_lock(), "Waiting on condition variable %p without owning the mutex", static_cast<void*>(_p_condvar));
+  Mutex* p_mutex = lock.mutex();
+  ZephyrBoolResult res;
+#if CONFIG_ZPP_MUTEX_FUTEX
+  // a notification between the unlock and the wait changes the sequence number, and the
+  // futex wait then returns immediately
+  atomic_val_t sequence = atomic_get(&_p_futex->val);
+  auto unlock_res       = p_mutex->unlock();
+  if (!unlock_res) {
+    res.assign_value(false);
+    res.assign_error(unlock_res.error());
+    return res;
+  }
+  int ret = k_futex_wait(_p_futex, sequence, timeout);
+  // the mutex is owned again in all cases, as with k_condvar_wait
+  auto lock_res = p_mutex->lock();
+  if (ret == -ETIMEDOUT) {
+    // timeout -> return false without error
+    res.assign_value(false);
+  } else if (ret != 0 && ret != -EAGAIN) {
+    ZPP_LOG_ERR("Cannot wait on condition variable: %d", ret);
+    res.assign_value(false);
+    res.assign_error(zephyr_to_zpp_error_code(ret));
+  } else if (!lock_res) {
+    res.assign_value(false);
+    res.assign_error(lock_res.error());
+  }
+#else   // CONFIG_ZPP_MUTEX_FUTEX
+#if CONFIG_ZPP_MUTEX_STATS
+  // the mutex is released and acquired again by the kernel
+  p_mutex->record_release();
+#endif  // CONFIG_ZPP_MUTEX_STATS
+  int ret = k_condvar_wait(_p_condvar, p_mutex->_p_mutex, timeout);
+#if CONFIG_ZPP_MUTEX_STATS
+  // the time spent waiting for the mutex cannot be told apart from the time spent
+  // waiting for the notification: the reacquisition is not counted as an acquisition,
+  // only the ownership is restored for measuring the hold time
+  p_mutex->record_ownership(k_cycle_get_32());
+#endif  // CONFIG_ZPP_MUTEX_STATS
+  if (ret == -EAGAIN) {
+    // timeout -> return false without error
+    res.assign_value(false);
+  } else if (ret != 0) {
+    ZPP_LOG_ERR("Cannot wait on condition variable: %d", ret);
+    res.assign_value(false);
+    res.assign_error(zephyr_to_zpp_error_code(ret));
+  }
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
+  return res;
+}
+
+void ConditionVariable::notify_one() noexcept {
+#if CONFIG_ZPP_MUTEX_FUTEX
+  atomic_inc(&_p_futex->val);
+  k_futex_wake(_p_futex, false);
+#else   // CONFIG_ZPP_MUTEX_FUTEX
+  k_condvar_signal(_p_condvar);
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
+}
+
+void ConditionVariable::notify_all() noexcept {
+#if CONFIG_ZPP_MUTEX_FUTEX
+  atomic_inc(&_p_futex->val);
+  k_futex_wake(_p_futex, true);
+#else   // CONFIG_ZPP_MUTEX_FUTEX
+  k_condvar_broadcast(_p_condvar);
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
+}
+
+std::chrono::microseconds ConditionVariable::deadline_after(const std::chrono::milliseconds& timeout) {
+  // absolute timeouts are expressed relative to the kernel uptime
+  return std::chrono::microseconds(k_ticks_to_us_floor64(k_uptime_ticks())) + timeout;
+}
+
+#if CONFIG_USERSPACE
+KernelObjectPoolStats ConditionVariable::get_pool_stats() noexcept {
+  return s_condvar_pool.get_stats();
+}
+
+void ConditionVariable::grant_access(k_tid_t tid) {
+  ZPP_LOG_DBG("Granting access to condition variable %p for thread %p", static_cast<void*>(_p_condvar), static_cast<void*>(tid));
+  k_object_access_grant(_p_condvar, tid);
+}
+#endif  // CONFIG_USERSPACE
+
+}  // namespace zpp_lib
@@ -41,8 +41,9 @@ extern struct k_mem_partition zpp_lib_partition;
 namespace zpp_lib {
 
 #if CONFIG_USERSPACE
-ZPP_LIB_DATA uint8_t gMsgqInstanceCount                          = 0;
-struct k_msgq ZPP_MESSAGE_QUEUE_ARRAY[CONFIG_ZPP_MSGQ_POOL_SIZE] = {};
+// the k_msgq array must be initialized in global memory (not application domain)
+static struct k_msgq ZPP_MESSAGE_QUEUE_ARRAY[CONFIG_ZPP_MSGQ_POOL_SIZE] = {};
+ZPP_LIB_DATA MessageQueuePool gMsgqPool([](size_t index) { return &ZPP_MESSAGE_QUEUE_ARRAY[index]; });
 #endif  // CONFIG_USERSPACE
 
 }  // namespace zpp_lib
@@ -29,10 +29,17 @@
 #include <zephyr/app_memory/app_memdomain.h>
 #endif  // CONFIG_USERSPACE
 
+#if CONFIG_ZPP_MUTEX_STATS
+// std
+#include <cstring>
+#endif  // CONFIG_ZPP_MUTEX_STATS
+
 // zpp_lib
 #include "zpp_include/clock.hpp"
+#include "zpp_include/kernel_object_pool.hpp"
 #include "zpp_include/zpp_assert.hpp"
 #include "zpp_include/zpp_log.hpp"
+#include "zpp_rtos/thread_pool_size.hpp"
 
 #if CONFIG_USERSPACE
 extern struct k_mem_partition zpp_lib_partition;
@@ -48,10 +55,6 @@ ZPP_LOG_MODULE_DECLARE(zpp_rtos, CONFIG_ZPP_RTOS_LOG_LEVEL);
 namespace zpp_lib {
 
 #if CONFIG_USERSPACE
-ZPP_LIB_BSS uint8_t Mutex::_mutexInstanceCount = 0;
-// we use busy semantics to avoid initialization
-ZPP_LIB_BSS bool ZPP_MUTEX_ARRAY_BUSY[CONFIG_ZPP_MUTEX_POOL_SIZE + CONFIG_ZPP_THREAD_POOL_SIZE];
-
 #define X(name) K_MUTEX_DEFINE(name);
 #include "mutexes.def"
 #undef X
@@ -60,61 +63,75 @@ ZPP_LIB_DATA
 static struct k_mutex* const ZPP_MUTEX_ARRAY[] = {
 #include "mutexes.def"  // NOLINT(build/include)
 };
-BUILD_ASSERT(ARRAY_SIZE(ZPP_MUTEX_ARRAY) >= CONFIG_ZPP_MUTEX_POOL_SIZE + CONFIG_ZPP_THREAD_POOL_SIZE);
+BUILD_ASSERT(ARRAY_SIZE(ZPP_MUTEX_ARRAY) >= CONFIG_ZPP_MUTEX_POOL_SIZE + ZPP_THREAD_TOTAL_POOL_SIZE);
 #undef X
+
+using MutexPool = KernelObjectPool<struct k_mutex, CONFIG_ZPP_MUTEX_POOL_SIZE + ZPP_THREAD_TOTAL_POOL_SIZE>;
+ZPP_LIB_DATA static MutexPool s_mutex_pool([](size_t index) { return ZPP_MUTEX_ARRAY[index]; });
 #endif  // CONFIG_USERSPACE
 
+#if CONFIG_ZPP_MUTEX_FUTEX
+// futex words live in the zpp_lib partition: user threads access them without system call
+ZPP_LIB_BSS struct k_futex ZPP_MUTEX_FUTEX_ARRAY[CONFIG_ZPP_MUTEX_POOL_SIZE + ZPP_THREAD_TOTAL_POOL_SIZE];
+
+// values of the futex word
+static constexpr atomic_val_t kFutexUnlocked  = 0;
+static constexpr atomic_val_t kFutexLocked    = 1;
+static constexpr atomic_val_t kFutexContended = 2;
+
+// returns the futex with the same pool index as the k_mutex
+static struct k_futex* mutex_to_futex(const struct k_mutex* p_mutex) {
+  size_t index = s_mutex_pool.index_of(p_mutex);
+  ZPP_ASSERT(index != kInvalidPoolIndex, "Mutex %p not found", static_cast<const void*>(p_mutex));
+  return index != kInvalidPoolIndex ? &ZPP_MUTEX_FUTEX_ARRAY[index] : nullptr;
+}
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
+
 // False positive, _mutex is initialized with k_mutex_init
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
 Mutex::Mutex() noexcept
-    :
 #if !CONFIG_USERSPACE
-      _p_mutex(&_mutex)
+    : _p_mutex(&_mutex)
 #endif  // !CONFIG_USERSPACE
 {
 #if CONFIG_USERSPACE
   // kernel objects are allocated statically
-  static constexpr uint8_t totalNbrOfMutexes = CONFIG_ZPP_MUTEX_POOL_SIZE + CONFIG_ZPP_THREAD_POOL_SIZE;
-  ZPP_ASSERT(_mutexInstanceCount < totalNbrOfMutexes,
+  _p_mutex = s_mutex_pool.allocate(_pool_index);
+  ZPP_ASSERT(_p_mutex != nullptr,
              "Too many mutexes created (pool size is %d)",
-             CONFIG_ZPP_MUTEX_POOL_SIZE + CONFIG_ZPP_THREAD_POOL_SIZE);
-
-  // find a free mutex
-  uint8_t index = 0;
-  for (; index < totalNbrOfMutexes; index++) {
-    if (!ZPP_MUTEX_ARRAY_BUSY[index]) {
-      break;
-    }
-  }
-  ZPP_ASSERT(index < totalNbrOfMutexes, "Internal error: free mutex not found");
-
-  // update the thread instance count
-  ZPP_MUTEX_ARRAY_BUSY[index] = true;
-  _p_mutex                    = ZPP_MUTEX_ARRAY[index];
-  _mutexInstanceCount++;
-  ZPP_LOG_DBG("Mutex %p allocated (instance index %d, total %d)", static_cast<void*>(_p_mutex), index, _mutexInstanceCount);
+             CONFIG_ZPP_MUTEX_POOL_SIZE + ZPP_THREAD_TOTAL_POOL_SIZE);
+#if CONFIG_ZPP_MUTEX_FUTEX
+  _p_futex = &ZPP_MUTEX_FUTEX_ARRAY[_pool_index];
+  atomic_set(&_p_futex->val, kFutexUnlocked);
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
+  ZPP_LOG_DBG("Mutex %p allocated (instance index %d, total %d)",
+              static_cast<void*>(_p_mutex),
+              _pool_index,
+              s_mutex_pool.get_stats().nbr_of_used);
 #else   // CONFIG_USERSPACE
   k_mutex_init(&_mutex);
 #endif  // CONFIG_USERSPACE
 }
 
+Mutex::Mutex([[maybe_unused]] const char* name) noexcept : Mutex() {
+#if CONFIG_ZPP_MUTEX_STATS
+  _name = name;
+#endif  // CONFIG_ZPP_MUTEX_STATS
+}
+
 Mutex::~Mutex() {
 #if CONFIG_USERSPACE
-  bool found                                 = false;
-  static constexpr uint8_t totalNbrOfMutexes = CONFIG_ZPP_MUTEX_POOL_SIZE + CONFIG_ZPP_THREAD_POOL_SIZE;
-  for (uint8_t index = 0; index < totalNbrOfMutexes; index++) {
-    if (_p_mutex == ZPP_MUTEX_ARRAY[index]) {
-      // reinitialize the mutex
-      k_mutex_init(_p_mutex);
-      // flag it as free
-      ZPP_MUTEX_ARRAY_BUSY[index] = false;
-      _mutexInstanceCount--;
-      ZPP_LOG_DBG("Mutex %p freed (instance index %d, total %d)", static_cast<void*>(_p_mutex), index, _mutexInstanceCount);
-      found = true;
-      break;
-    }
+  // a mutex constructed from a kernel object does not own it
+  if (_pool_index == kInvalidPoolIndex) {
+    return;
   }
-  ZPP_ASSERT(found, "Mutex %p not found", static_cast<void*>(_p_mutex));
+  // reinitialize the mutex and give it back to the pool
+  k_mutex_init(_p_mutex);
+  s_mutex_pool.free(_pool_index);
+  ZPP_LOG_DBG("Mutex %p freed (instance index %d, total %d)",
+              static_cast<void*>(_p_mutex),
+              _pool_index,
+              s_mutex_pool.get_stats().nbr_of_used);
 #endif  // CONFIG_USERSPACE
 }
 
@@ -122,12 +139,37 @@ Mutex::~Mutex() {
 Mutex::Mutex(k_mutex* pMutex) noexcept {
   ZPP_LOG_DBG("Copy mutex with address %p", static_cast<void*>(pMutex));
   _p_mutex = pMutex;
+#if CONFIG_ZPP_MUTEX_FUTEX
+  _p_futex = mutex_to_futex(pMutex);
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
 }
 #endif  // CONFIG_USERSPACE
 
+#if CONFIG_ZPP_MUTEX_STATS
+ZephyrResult Mutex::lock_impl() {
+#else   // CONFIG_ZPP_MUTEX_STATS
 ZephyrResult Mutex::lock() {
+#endif  // CONFIG_ZPP_MUTEX_STATS
   ZPP_LOG_DBG("Locking mutex %p", static_cast<void*>(_p_mutex));
   ZephyrResult res;
+#if CONFIG_ZPP_MUTEX_FUTEX
+  // uncontended path: no system call
+  if (atomic_cas(&_p_futex->val, kFutexUnlocked, kFutexLocked)) {
+    return res;
+  }
+  // contended path: flag the mutex as contended and wait until it is unlocked
+  while (atomic_set(&_p_futex->val, kFutexContended) != kFutexUnlocked) {
+    int ret = k_futex_wait(_p_futex, kFutexContended, K_FOREVER);
+    // -EAGAIN means that the mutex was unlocked before waiting
+    if (ret != 0 && ret != -EAGAIN) {
+      ZPP_LOG_ERR("Cannot lock mutex: %d", ret);
+      ZPP_ASSERT(false, "Cannot lock mutex: %d", ret);
+      res.assign_error(zephyr_to_zpp_error_code(ret));
+      return res;
+    }
+  }
+  return res;
+#else   // CONFIG_ZPP_MUTEX_FUTEX
   int ret = k_mutex_lock(_p_mutex, K_FOREVER);
   if (ret != 0) {
     ZPP_LOG_ERR("Cannot lock mutex: %d", ret);
@@ -135,18 +177,53 @@ ZephyrResult Mutex::lock() {
     res.assign_error(zephyr_to_zpp_error_code(ret));
   }
   return res;
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
 }
 
 ZephyrBoolResult Mutex::try_lock() noexcept {
   return try_lock_for(std::chrono::milliseconds::zero());
 }
 
+#if CONFIG_ZPP_MUTEX_STATS
+ZephyrBoolResult Mutex::try_lock_for_impl(const std::chrono::milliseconds& timeout) noexcept {
+#else   // CONFIG_ZPP_MUTEX_STATS
 ZephyrBoolResult Mutex::try_lock_for(const std::chrono::milliseconds& timeout) noexcept {
+#endif  // CONFIG_ZPP_MUTEX_STATS
   ZPP_LOG_DBG("Trying to lock mutex with timeout %lld ms (ticks %lld)", timeout.count(), milliseconds_to_ticks(timeout).ticks);
+#if CONFIG_ZPP_MUTEX_FUTEX
+  ZephyrBoolResult res;
+  // uncontended path: no system call
+  if (atomic_cas(&_p_futex->val, kFutexUnlocked, kFutexLocked)) {
+    return res;
+  }
+  if (timeout.count() <= 0) {
+    res.assign_value(false);
+    return res;
+  }
+  // contended path: wait until the mutex is unlocked or the timeout expires
+  int64_t end_time = k_uptime_get() + timeout.count();
+  while (atomic_set(&_p_futex->val, kFutexContended) != kFutexUnlocked) {
+    int64_t remaining_time = end_time - k_uptime_get();
+    if (remaining_time <= 0) {
+      // timeout -> return false without error
+      res.assign_value(false);
+      return res;
+    }
+    int ret = k_futex_wait(_p_futex, kFutexContended, milliseconds_to_ticks(std::chrono::milliseconds(remaining_time)));
+    if (ret != 0 && ret != -EAGAIN && ret != -ETIMEDOUT) {
+      ZPP_LOG_ERR("Cannot lock mutex: %d", ret);
+      ZPP_ASSERT(false, "Cannot lock mutex: %d", ret);
+      res.assign_value(false);
+      res.assign_error(zephyr_to_zpp_error_code(ret));
+      return res;
+    }
+  }
+  return res;
+#else   // CONFIG_ZPP_MUTEX_FUTEX
   auto ret = k_mutex_lock(_p_mutex, milliseconds_to_ticks(timeout));
   ZephyrBoolResult res;
-  if (ret == -EAGAIN) {
-    // timeout -> return false without error
+  if (ret == -EAGAIN || ret == -EBUSY) {
+    // timeout or mutex not available without waiting -> return false without error
     res.assign_value(false);
   } else if (ret != 0) {
     // other failure -> return false with error
@@ -156,11 +233,31 @@ ZephyrBoolResult Mutex::try_lock_for(const std::chrono::milliseconds& timeout) n
     res.assign_error(zephyr_to_zpp_error_code(ret));
   }
   return res;
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
 }
 
+#if CONFIG_ZPP_MUTEX_STATS
+ZephyrResult Mutex::unlock_impl() {
+#else   // CONFIG_ZPP_MUTEX_STATS
 ZephyrResult Mutex::unlock() {
+#endif  // CONFIG_ZPP_MUTEX_STATS
   ZPP_LOG_DBG("Unlocking mutex %p", static_cast<void*>(_p_mutex));
   ZephyrResult res;
+#if CONFIG_ZPP_MUTEX_FUTEX
+  // uncontended path: no system call
+  if (atomic_dec(&_p_futex->val) != kFutexContended) {
+    return res;
+  }
+  // contended path: unlock and wake up one waiting thread
+  atomic_set(&_p_futex->val, kFutexUnlocked);
+  int ret = k_futex_wake(_p_futex, false);
+  if (ret < 0) {
+    ZPP_LOG_ERR("Cannot unlock mutex: %d", ret);
+    ZPP_ASSERT(false, "Cannot unlock mutex: %d", ret);
+    res.assign_error(zephyr_to_zpp_error_code(ret));
+  }
+  return res;
+#else   // CONFIG_ZPP_MUTEX_FUTEX
   int ret = k_mutex_unlock(_p_mutex);
   if (ret != 0) {
     ZPP_LOG_ERR("Cannot unlock mutex: %d", ret);
@@ -168,9 +265,126 @@ ZephyrResult Mutex::unlock() {
     res.assign_error(zephyr_to_zpp_error_code(ret));
   }
   return res;
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
+}
+
+#if CONFIG_ZPP_MUTEX_STATS
+ZephyrResult Mutex::lock() {
+  uint32_t wait_start_cycles = k_cycle_get_32();
+  // try without waiting first, for distinguishing contended acquisitions
+  ZephyrResult res;
+  auto acquired = try_lock_for_impl(std::chrono::milliseconds::zero());
+  if (acquired.has_error()) {
+    res.assign_error(acquired.error());
+    return res;
+  }
+  if (acquired) {
+    record_acquisition(wait_start_cycles, nullptr);
+    return res;
+  }
+  char owner_name[CONFIG_THREAD_MAX_NAME_LEN] = {0};
+  copy_owner_name(owner_name, sizeof(owner_name));
+  res = lock_impl();
+  if (res) {
+    record_acquisition(wait_start_cycles, owner_name);
+  }
+  return res;
+}
+
+ZephyrBoolResult Mutex::try_lock_for(const std::chrono::milliseconds& timeout) noexcept {
+  uint32_t wait_start_cycles = k_cycle_get_32();
+  // try without waiting first, for distinguishing contended acquisitions
+  auto res = try_lock_for_impl(std::chrono::milliseconds::zero());
+  if (res.has_error()) {
+    return res;
+  }
+  if (res) {
+    record_acquisition(wait_start_cycles, nullptr);
+    return res;
+  }
+  if (timeout.count() <= 0) {
+    return res;
+  }
+  char owner_name[CONFIG_THREAD_MAX_NAME_LEN] = {0};
+  copy_owner_name(owner_name, sizeof(owner_name));
+  res = try_lock_for_impl(timeout);
+  if (!res.has_error() && res) {
+    record_acquisition(wait_start_cycles, owner_name);
+  }
+  return res;
+}
+
+ZephyrResult Mutex::unlock() {
+  record_release();
+  return unlock_impl();
+}
+
+MutexStats Mutex::get_stats() const noexcept {
+  MutexStats stats;
+  stats.name                          = _name;
+  stats.nbr_of_acquisitions           = _nbr_of_acquisitions;
+  stats.nbr_of_contended_acquisitions = _nbr_of_contended_acquisitions;
+  stats.total_wait_time               = std::chrono::microseconds(k_cyc_to_us_floor64(_total_wait_cycles));
+  stats.max_wait_time                 = std::chrono::microseconds(k_cyc_to_us_floor64(_max_wait_cycles));
+  stats.max_hold_time                 = std::chrono::microseconds(k_cyc_to_us_floor64(_max_hold_cycles));
+  std::strncpy(stats.worst_wait_owner, _worst_wait_owner, sizeof(stats.worst_wait_owner) - 1);
+  return stats;
 }
 
+void Mutex::copy_owner_name(char* owner_name, size_t size) const {
+  // the owner may release the mutex concurrently, read it once
+  k_tid_t owner = _owner;
+  if (owner == nullptr || k_thread_name_copy(owner, owner_name, size) != 0 || owner_name[0] == '\0') {
+    std::strncpy(owner_name, "unknown", size - 1);
+  }
+}
+
+void Mutex::record_acquisition(uint32_t wait_start_cycles, const char* owner_name) {
+  // the mutex is owned by the current thread, no other thread modifies the statistics
+  uint32_t now_cycles = k_cycle_get_32();
+  _nbr_of_acquisitions++;
+  if (owner_name != nullptr) {
+    uint32_t wait_cycles = now_cycles - wait_start_cycles;
+    _nbr_of_contended_acquisitions++;
+    _total_wait_cycles += wait_cycles;
+    if (wait_cycles > _max_wait_cycles) {
+      _max_wait_cycles = wait_cycles;
+      std::strncpy(_worst_wait_owner, owner_name, sizeof(_worst_wait_owner) - 1);
+    }
+  }
+  record_ownership(now_cycles);
+}
+
+void Mutex::record_ownership(uint32_t now_cycles) {
+  // the hold time of a recursively locked mutex starts with the outermost lock
+  if (_lock_depth == 0) {
+    _owner          = k_current_get();
+    _acquire_cycles = now_cycles;
+  }
+  _lock_depth++;
+}
+
+void Mutex::record_release() {
+  if (_lock_depth == 0 || _owner != k_current_get()) {
+    // not owned by the current thread, unlock_impl() reports the error
+    return;
+  }
+  _lock_depth--;
+  if (_lock_depth == 0) {
+    uint32_t hold_cycles = k_cycle_get_32() - _acquire_cycles;
+    if (hold_cycles > _max_hold_cycles) {
+      _max_hold_cycles = hold_cycles;
+    }
+    _owner = nullptr;
+  }
+}
+#endif  // CONFIG_ZPP_MUTEX_STATS
+
 #if CONFIG_USERSPACE
+KernelObjectPoolStats Mutex::get_pool_stats() noexcept {
+  return s_mutex_pool.get_stats();
+}
+
 void Mutex::grant_access(k_tid_t tid) {
   ZPP_LOG_DBG("Granting access to mutex %p for thread %p", static_cast<void*>(_p_mutex), static_cast<void*>(tid));
   k_object_access_grant(_p_mutex, tid);
@@ -0,0 +1,206 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file periodic_thread.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief PeriodicThread class implementation
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "zpp_include/periodic_thread.hpp"
+
+// std
+#include <mutex>
+#include <utility>
+
+// zpp_lib
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_log.hpp"
+
+ZPP_LOG_MODULE_DECLARE(zpp_rtos, CONFIG_ZPP_RTOS_LOG_LEVEL);
+
+namespace zpp_lib {
+
+static std::chrono::microseconds ticks_to_microseconds(int64_t ticks) {
+  return std::chrono::microseconds(static_cast<int64_t>(k_ticks_to_us_floor64(static_cast<uint64_t>(ticks))));
+}
+
+#if CONFIG_USERSPACE
+PeriodicThread::PeriodicThread(PreemptableThreadPriority priority,
+                               const char* name,
+                               const std::chrono::microseconds& period,
+                               bool userMode,
+                               size_t stack_size)
+    : _thread(priority, name, userMode, stack_size), _period(period), _user_mode(userMode) {
+}
+
+PeriodicThread::PeriodicThread(CooperativeThreadPriority priority,
+                               const char* name,
+                               const std::chrono::microseconds& period,
+                               bool userMode,
+                               size_t stack_size)
+    : _thread(priority, name, userMode, stack_size), _period(period), _user_mode(userMode) {
+}
+#else   // CONFIG_USERSPACE
+PeriodicThread::PeriodicThread(PreemptableThreadPriority priority,
+                               const char* name,
+                               const std::chrono::microseconds& period,
+                               size_t stack_size)
+    : _thread(priority, name, stack_size), _period(period) {
+}
+
+PeriodicThread::PeriodicThread(CooperativeThreadPriority priority,
+                               const char* name,
+                               const std::chrono::microseconds& period,
+                               size_t stack_size)
+    : _thread(priority, name, stack_size), _period(period) {
+}
+#endif  // CONFIG_USERSPACE
+
+PeriodicThread::~PeriodicThread() {
+  auto res = stop();
+  if (!res) {
+    ZPP_LOG_DBG("Failed to stop periodic thread: %d", static_cast<int>(res.error()));
+  }
+}
+
+ZephyrResult PeriodicThread::start(job_function_t job) noexcept {
+  return start(std::move(job), ticks_to_microseconds(k_uptime_ticks()));
+}
+
+ZephyrResult PeriodicThread::start(job_function_t job, const std::chrono::microseconds& first_release) noexcept {
+  ZephyrResult res;
+  // the underlying thread can only be started once, also after stop()
+  if (_is_started.load()) {
+    res.assign_error(ZephyrErrorCode::Already);
+    return res;
+  }
+  _period_ticks = static_cast<int64_t>(k_us_to_ticks_ceil64(static_cast<uint64_t>(_period.count())));
+  if (_period.count() <= 0 || _period_ticks == 0) {
+    ZPP_LOG_ERR("Invalid period %lld us", _period.count());
+    res.assign_error(ZephyrErrorCode::Inval);
+    return res;
+  }
+  _next_release_ticks = static_cast<int64_t>(k_us_to_ticks_ceil64(static_cast<uint64_t>(first_release.count())));
+  _job                = std::move(job);
+  _stop_requested.store(false);
+
+  res = _thread.start([this]() { this->run(); });
+  if (res) {
+    _is_started.store(true);
+#if CONFIG_USERSPACE
+    if (_user_mode) {
+      // the thread updates the statistics after each job
+      _stats_mutex.grant_access(_thread.get_tid());
+      _is_access_granted.store(true);
+    }
+#endif  // CONFIG_USERSPACE
+  }
+  return res;
+}
+
+ZephyrResult PeriodicThread::stop() noexcept {
+  ZephyrResult res;
+  if (!_is_started.load() || _is_stopped.load()) {
+    // not started or already stopped, return silently
+    return res;
+  }
+  _stop_requested.store(true);
+  res = _thread.join();
+  if (res) {
+    _is_stopped.store(true);
+  }
+  return res;
+}
+
+PeriodicThreadStats PeriodicThread::get_stats() const noexcept {
+  std::scoped_lock<Mutex> guard(_stats_mutex);
+
+  PeriodicThreadStats stats;
+  stats.nbr_of_releases = _nbr_of_releases;
+  stats.nbr_of_overruns = _nbr_of_overruns;
+  if (_nbr_of_releases > 0) {
+    stats.min_release_jitter = ticks_to_microseconds(_min_jitter_ticks);
+    stats.max_release_jitter = ticks_to_microseconds(_max_jitter_ticks);
+    stats.avg_release_jitter = ticks_to_microseconds(_sum_jitter_ticks / _nbr_of_releases);
+    stats.min_response_time  = ticks_to_microseconds(_min_response_ticks);
+    stats.max_response_time  = ticks_to_microseconds(_max_response_ticks);
+    stats.avg_response_time  = ticks_to_microseconds(_sum_response_ticks / _nbr_of_releases);
+  }
+  return stats;
+}
+
+std::chrono::microseconds PeriodicThread::get_period() const noexcept {
+  return _period;
+}
+
+void PeriodicThread::run() {
+#if CONFIG_USERSPACE
+  // a user mode thread may run before start() granted it access to the statistics
+  // mutex, sleeping lets the starting thread run whatever the priorities
+  while (_user_mode && !_is_access_granted.load()) {
+    k_sleep(K_TICKS(1));
+  }
+#endif  // CONFIG_USERSPACE
+  while (!_stop_requested.load()) {
+    // sleep until the absolute release time, so that releases do not drift
+    // NOLINTNEXTLINE(readability-math-missing-parentheses) -- this is a zephyr macro
+    k_sleep(K_TIMEOUT_ABS_TICKS(_next_release_ticks));
+    if (_stop_requested.load()) {
+      break;
+    }
+
+    int64_t release_ticks = _next_release_ticks;
+    int64_t start_ticks   = k_uptime_ticks();
+    _job();
+    int64_t end_ticks = k_uptime_ticks();
+
+    // skip the releases that were missed by an overrunning job
+    _next_release_ticks += _period_ticks;
+    while (_next_release_ticks < end_ticks) {
+      _next_release_ticks += _period_ticks;
+    }
+    update_stats(release_ticks, start_ticks, end_ticks);
+  }
+}
+
+void PeriodicThread::update_stats(int64_t release_ticks, int64_t start_ticks, int64_t end_ticks) {
+  std::scoped_lock<Mutex> guard(_stats_mutex);
+
+  int64_t jitter_ticks   = start_ticks - release_ticks;
+  int64_t response_ticks = end_ticks - release_ticks;
+  if (_nbr_of_releases == 0) {
+    _min_jitter_ticks   = jitter_ticks;
+    _max_jitter_ticks   = jitter_ticks;
+    _min_response_ticks = response_ticks;
+    _max_response_ticks = response_ticks;
+  } else {
+    _min_jitter_ticks   = jitter_ticks < _min_jitter_ticks ? jitter_ticks : _min_jitter_ticks;
+    _max_jitter_ticks   = jitter_ticks > _max_jitter_ticks ? jitter_ticks : _max_jitter_ticks;
+    _min_response_ticks = response_ticks < _min_response_ticks ? response_ticks : _min_response_ticks;
+    _max_response_ticks = response_ticks > _max_response_ticks ? response_ticks : _max_response_ticks;
+  }
+  _sum_jitter_ticks += jitter_ticks;
+  _sum_response_ticks += response_ticks;
+  _nbr_of_releases++;
+  if (response_ticks > _period_ticks) {
+    _nbr_of_overruns++;
+  }
+}
+
+}  // namespace zpp_lib
@@ -30,6 +30,8 @@
 #endif  // CONFIG_USERSPACE
 
 // zpp_lib
+#include "zpp_include/clock.hpp"
+#include "zpp_include/kernel_object_pool.hpp"
 #include "zpp_include/zpp_assert.hpp"
 #include "zpp_include/zpp_log.hpp"
 
@@ -47,11 +49,11 @@ extern struct k_mem_partition zpp_lib_partition;
 namespace zpp_lib {
 
 #if CONFIG_USERSPACE
-ZPP_LIB_BSS uint8_t Semaphore::_semaphoreInstanceCount = 0;
-// we use busy semantics to avoid initialization
-ZPP_LIB_BSS bool ZPP_SEMAPHORE_ARRAY_BUSY[CONFIG_ZPP_MUTEX_POOL_SIZE + CONFIG_ZPP_THREAD_POOL_SIZE];
 // the k_sem array must be initialized in global memory (not application domain)
 static struct k_sem ZPP_SEMAPHORE_ARRAY[CONFIG_ZPP_SEMAPHORE_POOL_SIZE] = {};
+
+using SemaphorePool = KernelObjectPool<struct k_sem, CONFIG_ZPP_SEMAPHORE_POOL_SIZE>;
+ZPP_LIB_DATA static SemaphorePool s_semaphore_pool([](size_t index) { return &ZPP_SEMAPHORE_ARRAY[index]; });
 #endif  // CONFIG_USERSPACE
 
 // False positive, _sem is initialized with k_sem_init
@@ -59,28 +61,18 @@ static struct k_sem ZPP_SEMAPHORE_ARRAY[CONFIG_ZPP_SEMAPHORE_POOL_SIZE] = {};
 Semaphore::Semaphore(uint32_t initial_count, uint32_t max_count) noexcept {
 #if CONFIG_USERSPACE
   // kernel objects are allocated statically
-  ZPP_ASSERT(_semaphoreInstanceCount < CONFIG_ZPP_SEMAPHORE_POOL_SIZE,
-             "Too many semaphores created (pool size is %d)",
-             CONFIG_ZPP_SEMAPHORE_POOL_SIZE);
-
-  // find a free semaphore
-  uint8_t index = 0;
-  for (; index < CONFIG_ZPP_SEMAPHORE_POOL_SIZE; index++) {
-    if (!ZPP_SEMAPHORE_ARRAY_BUSY[index]) {
-      break;
-    }
-  }
-  __ASSERT(index < CONFIG_ZPP_SEMAPHORE_POOL_SIZE, "Internal error: free semaphore not found");
+  _p_sem = s_semaphore_pool.allocate(_pool_index);
+  ZPP_ASSERT(_p_sem != nullptr, "Too many semaphores created (pool size is %d)", CONFIG_ZPP_SEMAPHORE_POOL_SIZE);
 
-  // update the thread instance count
-  __ASSERT_EVAL(k_sem_init(&ZPP_SEMAPHORE_ARRAY[index], initial_count, max_count),
-                auto ret = k_sem_init(&ZPP_SEMAPHORE_ARRAY[index], initial_count, max_count),
+  __ASSERT_EVAL(k_sem_init(_p_sem, initial_count, max_count),
+                auto ret = k_sem_init(_p_sem, initial_count, max_count),
                 ret == 0,
                 "Cannot create semaphore: %d",
                 ret);
-  _p_sem = &ZPP_SEMAPHORE_ARRAY[index];
-  _semaphoreInstanceCount++;
-  ZPP_LOG_DBG("Semaphore %p allocated (instance index %d, total %d)", static_cast<void*>(_p_sem), index, _semaphoreInstanceCount);
+  ZPP_LOG_DBG("Semaphore %p allocated (instance index %d, total %d)",
+              static_cast<void*>(_p_sem),
+              _pool_index,
+              s_semaphore_pool.get_stats().nbr_of_used);
 #else   // CONFIG_USERSPACE
   ZPP_ASSERT_EVAL(k_sem_init(&_sem, initial_count, max_count),
                   auto ret = k_sem_init(&_sem, initial_count, max_count),
@@ -98,18 +90,11 @@ Semaphore::Semaphore(uint32_t initial_count, uint32_t max_count) noexcept {
 
 Semaphore::~Semaphore() {
 #if CONFIG_USERSPACE
-  bool found = false;
-  for (uint8_t index = 0; index < CONFIG_ZPP_SEMAPHORE_POOL_SIZE; index++) {
-    if (_p_sem == &ZPP_SEMAPHORE_ARRAY[index]) {
-      // flag it as free
-      ZPP_SEMAPHORE_ARRAY_BUSY[index] = false;
-      _semaphoreInstanceCount--;
-      ZPP_LOG_DBG("Semaphore %p freed (instance index %d, total %d)", static_cast<void*>(_p_sem), index, _semaphoreInstanceCount);
-      found = true;
-      break;
-    }
-  }
-  __ASSERT(found, "Semaphore %p not found", static_cast<void*>(_p_sem));
+  s_semaphore_pool.free(_pool_index);
+  ZPP_LOG_DBG("Semaphore %p freed (instance index %d, total %d)",
+              static_cast<void*>(_p_sem),
+              _pool_index,
+              s_semaphore_pool.get_stats().nbr_of_used);
 #endif  // CONFIG_USERSPACE
 }
 
@@ -125,9 +110,61 @@ ZephyrResult Semaphore::acquire() {
 }
 
 ZephyrBoolResult Semaphore::try_acquire() {
+  return take(K_NO_WAIT);
+}
+
+ZephyrBoolResult Semaphore::try_acquire_for(const std::chrono::milliseconds& timeout) {
+  return take(milliseconds_to_ticks(timeout));
+}
+
+ZephyrBoolResult Semaphore::try_acquire_until(const std::chrono::microseconds& absolute_time) {
+  return take(K_TIMEOUT_ABS_US(absolute_time.count()));
+}
+
+ZephyrBoolResult Semaphore::acquire_n(uint32_t count, const std::chrono::milliseconds& timeout) {
+  // all resources must be acquired before the same deadline, expressed in system ticks
+  int64_t deadline_ticks = k_uptime_ticks() + static_cast<int64_t>(k_ms_to_ticks_ceil64(timeout.count()));
+  for (uint32_t nbr_of_acquired = 0; nbr_of_acquired < count; nbr_of_acquired++) {
+    auto res = take(K_TIMEOUT_ABS_TICKS(deadline_ticks));
+    if (res.has_error() || !res) {
+      // give back the resources acquired so far
+      static_cast<void>(release(nbr_of_acquired));
+      return res;
+    }
+  }
+  return ZephyrBoolResult();
+}
+
+ZephyrResult Semaphore::release() {
+  ZephyrResult res;
+  ZPP_LOG_DBG("Releasing semaphore %p with count %d", _p_sem, k_sem_count_get(_p_sem));
+  k_sem_give(_p_sem);
+  return res;
+}
+
+ZephyrResult Semaphore::release(uint32_t count) {
+  ZephyrResult res;
+  ZPP_LOG_DBG("Releasing semaphore %p %d times with count %d", _p_sem, count, k_sem_count_get(_p_sem));
+  // each give may make a waiter ready: with the scheduler locked, no waiter preempts the
+  // caller before all resources are given. In ISRs, rescheduling only happens on exit and
+  // user mode threads cannot lock the scheduler.
+  bool lock_scheduler = !k_is_in_isr() && !k_is_user_context();
+  if (lock_scheduler) {
+    k_sched_lock();
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    k_sem_give(_p_sem);
+  }
+  if (lock_scheduler) {
+    k_sched_unlock();
+  }
+  return res;
+}
+
+ZephyrBoolResult Semaphore::take(k_timeout_t timeout) {
   ZephyrBoolResult res;
-  int ret = k_sem_take(_p_sem, K_NO_WAIT);
-  if (ret == -EBUSY) {
+  int ret = k_sem_take(_p_sem, timeout);
+  if (ret == -EAGAIN || ret == -EBUSY) {
     // timeout -> return false without error
     res.assign_value(false);
   } else if (ret != 0) {
@@ -139,14 +176,11 @@ ZephyrBoolResult Semaphore::try_acquire() {
   return res;
 }
 
-ZephyrResult Semaphore::release() {
-  ZephyrResult res;
-  ZPP_LOG_DBG("Releasing semaphore %p with count %d", _p_sem, k_sem_count_get(_p_sem));
-  k_sem_give(_p_sem);
-  return res;
+#if CONFIG_USERSPACE
+KernelObjectPoolStats Semaphore::get_pool_stats() noexcept {
+  return s_semaphore_pool.get_stats();
 }
 
-#if CONFIG_USERSPACE
 void Semaphore::grant_access(k_tid_t tid) {
   ZPP_LOG_DBG("Granting access to semaphore %p for thread %p", static_cast<void*>(_p_sem), static_cast<void*>(tid));
   k_object_access_grant(_p_sem, tid);
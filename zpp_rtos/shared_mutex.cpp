@@ -0,0 +1,192 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file shared_mutex.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief SharedMutex class implementation
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "zpp_include/shared_mutex.hpp"
+
+// std
+#include <mutex>
+
+// zpp_lib
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_log.hpp"
+
+ZPP_LOG_MODULE_DECLARE(zpp_rtos, CONFIG_ZPP_RTOS_LOG_LEVEL);
+
+namespace zpp_lib {
+
+SharedMutex::SharedMutex() noexcept : _readers_semaphore{0, K_SEM_MAX_LIMIT}, _writer_semaphore{0, 1} {}
+
+ZephyrResult SharedMutex::lock() {
+  {
+    std::scoped_lock<Mutex> guard(_mutex);
+    if (!_is_writer_active && _nbr_of_readers == 0) {
+      _is_writer_active = true;
+      return ZephyrResult();
+    }
+    _nbr_of_waiting_writers++;
+  }
+  // the releasing thread hands the mutex over to this thread
+  return _writer_semaphore.acquire();
+}
+
+ZephyrBoolResult SharedMutex::try_lock() noexcept {
+  return try_lock_for(std::chrono::milliseconds::zero());
+}
+
+ZephyrBoolResult SharedMutex::try_lock_for(const std::chrono::milliseconds& timeout) noexcept {
+  ZephyrBoolResult res;
+  {
+    std::scoped_lock<Mutex> guard(_mutex);
+    if (!_is_writer_active && _nbr_of_readers == 0) {
+      _is_writer_active = true;
+      return res;
+    }
+    if (timeout.count() <= 0) {
+      res.assign_value(false);
+      return res;
+    }
+    _nbr_of_waiting_writers++;
+  }
+
+  res = _writer_semaphore.try_acquire_for(timeout);
+  if (res.has_error() || res) {
+    return res;
+  }
+
+  // timeout: the mutex may have been handed over to this thread before locking _mutex
+  std::scoped_lock<Mutex> guard(_mutex);
+  res = _writer_semaphore.try_acquire();
+  if (!res.has_error() && !res) {
+    _nbr_of_waiting_writers--;
+    // readers waiting behind this writer may now own the mutex
+    wake_up_waiters();
+  }
+  return res;
+}
+
+ZephyrResult SharedMutex::unlock() {
+  ZephyrResult res;
+  std::scoped_lock<Mutex> guard(_mutex);
+  if (!_is_writer_active) {
+    ZPP_LOG_ERR("SharedMutex not owned exclusively");
+    res.assign_error(ZephyrErrorCode::Perm);
+    return res;
+  }
+  _is_writer_active = false;
+  wake_up_waiters();
+  return res;
+}
+
+ZephyrResult SharedMutex::lock_shared() {
+  {
+    std::scoped_lock<Mutex> guard(_mutex);
+    if (!_is_writer_active && _nbr_of_waiting_writers == 0) {
+      _nbr_of_readers++;
+      return ZephyrResult();
+    }
+    _nbr_of_waiting_readers++;
+  }
+  // the releasing writer hands the mutex over to this thread
+  return _readers_semaphore.acquire();
+}
+
+ZephyrBoolResult SharedMutex::try_lock_shared() noexcept {
+  return try_lock_shared_for(std::chrono::milliseconds::zero());
+}
+
+ZephyrBoolResult SharedMutex::try_lock_shared_for(const std::chrono::milliseconds& timeout) noexcept {
+  ZephyrBoolResult res;
+  {
+    std::scoped_lock<Mutex> guard(_mutex);
+    if (!_is_writer_active && _nbr_of_waiting_writers == 0) {
+      _nbr_of_readers++;
+      return res;
+    }
+    if (timeout.count() <= 0) {
+      res.assign_value(false);
+      return res;
+    }
+    _nbr_of_waiting_readers++;
+  }
+
+  res = _readers_semaphore.try_acquire_for(timeout);
+  if (res.has_error() || res) {
+    return res;
+  }
+
+  // timeout: the mutex may have been handed over to this thread before locking _mutex
+  std::scoped_lock<Mutex> guard(_mutex);
+  res = _readers_semaphore.try_acquire();
+  if (!res.has_error() && !res) {
+    _nbr_of_waiting_readers--;
+  }
+  return res;
+}
+
+ZephyrResult SharedMutex::unlock_shared() {
+  ZephyrResult res;
+  std::scoped_lock<Mutex> guard(_mutex);
+  if (_nbr_of_readers == 0) {
+    ZPP_LOG_ERR("SharedMutex not owned in shared mode");
+    res.assign_error(ZephyrErrorCode::Perm);
+    return res;
+  }
+  _nbr_of_readers--;
+  wake_up_waiters();
+  return res;
+}
+
+void SharedMutex::wake_up_waiters() {
+  if (_is_writer_active) {
+    return;
+  }
+  if (_nbr_of_waiting_writers > 0) {
+    // writers are preferred, a writer gets the mutex once all readers have released it
+    if (_nbr_of_readers == 0) {
+      _nbr_of_waiting_writers--;
+      _is_writer_active = true;
+      auto res          = _writer_semaphore.release();
+      ZPP_ASSERT(res, "Cannot release semaphore: %d", static_cast<int>(res.error()));
+    }
+    return;
+  }
+  // no writer: all waiting readers get the mutex
+  while (_nbr_of_waiting_readers > 0) {
+    _nbr_of_waiting_readers--;
+    _nbr_of_readers++;
+    auto res = _readers_semaphore.release();
+    ZPP_ASSERT(res, "Cannot release semaphore: %d", static_cast<int>(res.error()));
+  }
+}
+
+#if CONFIG_USERSPACE
+void SharedMutex::grant_access(k_tid_t tid) {
+  ZPP_LOG_DBG("Granting access to shared mutex for thread %p", static_cast<void*>(tid));
+  _mutex.grant_access(tid);
+  _readers_semaphore.grant_access(tid);
+  _writer_semaphore.grant_access(tid);
+}
+#endif  // CONFIG_USERSPACE
+
+}  // namespace zpp_lib
@@ -0,0 +1,147 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_barrier.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib Barrier class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+#include <chrono>
+#include <optional>
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// zpp_rtos
+#include "zpp_include/barrier.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+// test helpers
+#include "zpp_benchmark.hpp"
+
+namespace {
+
+constexpr auto kSuiteName                       = "barrier";
+constexpr uint8_t kMaxNbrOfThreads              = 8;
+constexpr uint32_t kNbrOfPhases                 = 5;
+constexpr uint32_t kNbrOfRounds                 = 20;
+constexpr std::array kThreadNames               = {"thread0", "thread1", "thread2", "thread3", "thread4", "thread5", "thread6", "thread7"};
+constexpr std::array<uint8_t, 3> kNbrsOfThreads = {2, 4, 8};
+
+// state written by the threads waiting on the barriers
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<std::array<std::chrono::microseconds, kNbrOfPhases>, kMaxNbrOfThreads> s_phase_times = {};
+std::array<std::chrono::microseconds, kNbrOfPhases> s_completion_times                          = {};
+uint32_t s_nbr_of_completions                                                                   = 0;
+// cycle count at which the last thread reached the barrier, and release latencies
+uint32_t s_release_cycles                                                    = 0;
+std::array<std::array<uint32_t, kNbrOfRounds>, kMaxNbrOfThreads> s_latencies = {};
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+// runs task(thread_index) in nbr_of_threads threads and waits for their completion
+template <typename TaskF>
+void run_threads(uint8_t nbr_of_threads, TaskF task) {
+  std::array<std::optional<zpp_lib::Thread>, kMaxNbrOfThreads> threads;
+  for (uint8_t i = 0; i < nbr_of_threads; i++) {
+#if CONFIG_USERSPACE
+    threads[i].emplace(zpp_lib::PreemptableThreadPriority::PriorityNormal, kThreadNames[i], false);
+#else   // CONFIG_USERSPACE
+    threads[i].emplace(zpp_lib::PreemptableThreadPriority::PriorityNormal, kThreadNames[i]);
+#endif  // CONFIG_USERSPACE
+    zpp_zassert_true(threads[i]->start([&task, i]() { task(i); }), "Cannot start thread %d", i);
+  }
+  for (uint8_t i = 0; i < nbr_of_threads; i++) {
+    zpp_zassert_true(threads[i]->join(), "Cannot join thread %d", i);
+  }
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_barrier, test_reuse) {
+  // TESTPOINT: the barrier can be reused for several phases, all threads of a phase get
+  // the time given to the completion function
+  static constexpr uint8_t kNbrOfThreads = 3;
+  s_nbr_of_completions                   = 0;
+  zpp_lib::Barrier barrier(kNbrOfThreads, [](const std::chrono::microseconds& start_time) {
+    s_completion_times[s_nbr_of_completions] = start_time;
+    s_nbr_of_completions++;
+  });
+  run_threads(kNbrOfThreads, [&barrier](uint8_t thread_index) {
+    for (uint32_t phase = 0; phase < kNbrOfPhases; phase++) {
+      s_phase_times[thread_index][phase] = barrier.wait();
+    }
+  });
+
+  zpp_zassert_equal(s_nbr_of_completions, kNbrOfPhases, "Wrong number of completions");
+  zpp_zassert_equal(barrier.get_generation(), kNbrOfPhases, "Wrong number of phases");
+  for (uint32_t phase = 0; phase < kNbrOfPhases; phase++) {
+    for (uint8_t i = 0; i < kNbrOfThreads; i++) {
+      zpp_zassert_true(s_phase_times[i][phase] == s_completion_times[phase], "Thread %d got a wrong time in phase %d", i, phase);
+    }
+  }
+}
+
+ZPP_ZTEST(zpp_barrier, test_per_instance_time) {
+  // TESTPOINT: each barrier keeps its own synchronized time
+  zpp_lib::Barrier barrier1(1);
+  zpp_lib::Barrier barrier2(1);
+  auto time1 = barrier1.wait();
+  k_busy_wait(1000);
+  auto time2 = barrier2.wait();
+  zpp_zassert_true(time2 > time1, "Barriers share their time");
+  auto time3 = barrier1.wait();
+  zpp_zassert_true(time3 >= time2, "Barrier time not updated");
+  zpp_zassert_equal(barrier1.get_generation(), 2, "Wrong number of phases");
+  zpp_zassert_equal(barrier2.get_generation(), 1, "Wrong number of phases");
+}
+
+ZPP_ZTEST(zpp_barrier, test_benchmark_release) {
+  // measure the latency between the arrival of the last thread and the release of all
+  // threads, for an increasing number of threads
+  for (auto nbr_of_threads : kNbrsOfThreads) {
+    auto completion = [](const std::chrono::microseconds& /*start_time*/) { s_release_cycles = zpp_lib::benchmark::cycles_now(); };
+    zpp_lib::Barrier barrier(nbr_of_threads, completion);
+    run_threads(nbr_of_threads, [&barrier](uint8_t thread_index) {
+      for (uint32_t round = 0; round < kNbrOfRounds; round++) {
+        barrier.wait();
+        // s_release_cycles is not updated before all threads reach the barrier again
+        s_latencies[thread_index][round] = zpp_lib::benchmark::cycles_now() - s_release_cycles;
+      }
+    });
+
+    // the release latency of a round is the latency of the last released thread
+    zpp_lib::benchmark::CycleStats stats;
+    for (uint32_t round = 0; round < kNbrOfRounds; round++) {
+      uint32_t latency = 0;
+      for (uint8_t i = 0; i < nbr_of_threads; i++) {
+        latency = s_latencies[i][round] > latency ? s_latencies[i][round] : latency;
+      }
+      stats.add(latency);
+    }
+    static std::array<char, 32> s_name = {};
+    snprintk(s_name.data(), s_name.size(), "release_%d_threads", nbr_of_threads);
+    stats.report(kSuiteName, s_name.data());
+  }
+}
+
+ZPP_ZTEST_SUITE(zpp_barrier, nullptr, nullptr, nullptr, nullptr, nullptr);
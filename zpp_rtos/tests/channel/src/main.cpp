@@ -0,0 +1,146 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_channel.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib Channel class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <chrono>
+#include <memory>
+#include <utility>
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// zpp_rtos
+#include "zpp_include/channel.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""s;
+
+constexpr uint32_t kChannelSize = 4;
+constexpr uint32_t kNbrOfItems  = 100;
+constexpr auto kTimeout         = 5ms;
+
+// move-only message counting its live instances
+class Tracked {
+public:
+  Tracked() noexcept {
+    s_nbr_of_instances++;
+  }
+
+  explicit Tracked(uint32_t value) noexcept : _value(value) {
+    s_nbr_of_instances++;
+  }
+
+  Tracked(Tracked&& other) noexcept : _value(other._value) {
+    s_nbr_of_instances++;
+  }
+
+  Tracked& operator=(Tracked&& other) noexcept {
+    _value = other._value;
+    return *this;
+  }
+
+  Tracked(const Tracked&)            = delete;
+  Tracked& operator=(const Tracked&) = delete;
+
+  ~Tracked() {
+    s_nbr_of_instances--;
+  }
+
+  [[nodiscard]] uint32_t get_value() const noexcept {
+    return _value;
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static inline int32_t s_nbr_of_instances = 0;
+
+private:
+  uint32_t _value = 0;
+};
+
+}  // namespace
+
+ZPP_ZTEST(zpp_channel, test_move_only) {
+  zpp_lib::Channel<std::unique_ptr<uint32_t>, kChannelSize> channel;
+
+  // TESTPOINT: move-only messages are moved in and out of the channel, in order
+  auto p_value = std::make_unique<uint32_t>(1);
+  zpp_zassert_true(channel.try_put_for(0ms, std::move(p_value)), "Cannot put message");
+  zpp_zassert_true(p_value == nullptr, "Message not moved into the channel");
+  zpp_zassert_true(channel.try_emplace_for(0ms, std::make_unique<uint32_t>(2)), "Cannot emplace message");
+  zpp_zassert_equal(channel.get_nbr_of_queued_messages(), 2, "Wrong number of queued messages");
+  zpp_zassert_true(channel.try_get_for(0ms, p_value) && *p_value == 1, "Wrong message got");
+  zpp_zassert_true(channel.try_get_for(0ms, p_value) && *p_value == 2, "Wrong message got");
+
+  // TESTPOINT: getting from an empty channel expires
+  auto res = channel.try_get_for(kTimeout, p_value);
+  zpp_zassert_true(!res.has_error() && !res && *p_value == 2, "Message got from an empty channel");
+}
+
+ZPP_ZTEST(zpp_channel, test_capacity_and_lifetime) {
+  Tracked::s_nbr_of_instances = 0;
+  {
+    zpp_lib::Channel<Tracked, kChannelSize> channel;
+
+    // TESTPOINT: messages are constructed in place and putting to a full channel expires
+    for (uint32_t i = 0; i < kChannelSize; i++) {
+      zpp_zassert_true(channel.try_emplace_for(0ms, i), "Cannot emplace message");
+    }
+    zpp_zassert_equal(Tracked::s_nbr_of_instances, static_cast<int32_t>(kChannelSize), "Messages not constructed in place");
+    auto res = channel.try_emplace_for(kTimeout, kChannelSize);
+    zpp_zassert_true(!res.has_error() && !res, "Message put to a full channel");
+
+    // TESTPOINT: a message got frees a place in the channel
+    Tracked tracked;
+    zpp_zassert_true(channel.try_get_for(0ms, tracked) && tracked.get_value() == 0, "Wrong message got");
+    zpp_zassert_equal(Tracked::s_nbr_of_instances, static_cast<int32_t>(kChannelSize), "Message not destroyed in the channel");
+    zpp_zassert_true(channel.try_put_for(0ms, std::move(tracked)), "Cannot put message");
+  }
+
+  // TESTPOINT: messages still queued are destroyed with the channel
+  zpp_zassert_equal(Tracked::s_nbr_of_instances, 0, "Queued messages not destroyed");
+}
+
+ZPP_ZTEST(zpp_channel, test_producer_consumer) {
+  // TESTPOINT: a consumer gets all messages of a producer thread, in order
+  zpp_lib::Channel<std::unique_ptr<uint32_t>, kChannelSize> channel;
+  zpp_lib::Thread producer(zpp_lib::PreemptableThreadPriority::PriorityNormal, "producer");
+  auto res = producer.start([&channel]() {
+    for (uint32_t i = 0; i < kNbrOfItems; i++) {
+      zpp_zassert_true(channel.try_emplace_for(1s, std::make_unique<uint32_t>(i)), "Cannot emplace message");
+    }
+  });
+  zpp_zassert_true(res, "Cannot start producer");
+  std::unique_ptr<uint32_t> p_value;
+  for (uint32_t i = 0; i < kNbrOfItems; i++) {
+    zpp_zassert_true(channel.try_get_for(1s, p_value) && *p_value == i, "Wrong message got");
+  }
+  zpp_zassert_true(producer.join(), "Cannot join producer");
+}
+
+ZPP_ZTEST_SUITE(zpp_channel, nullptr, nullptr, nullptr, nullptr, nullptr);
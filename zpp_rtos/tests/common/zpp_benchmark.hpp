@@ -0,0 +1,129 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file zpp_benchmark.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Helpers for measuring and reporting cycle counts in the benchmark tests
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#if CONFIG_USERSPACE
+#include <zephyr/syscalls/time_syscalls.h>
+#endif  // CONFIG_USERSPACE
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// zpp_lib
+#include "zpp_include/thread.hpp"
+#include "zpp_include/zpp_assert.hpp"
+
+namespace zpp_lib::benchmark {
+
+// Returns the current value of the hardware cycle counter.
+// In user mode, the counter is read through a syscall, whose overhead is then
+// included in the measurements.
+inline uint32_t cycles_now() {
+#if CONFIG_USERSPACE
+  if (k_is_user_context()) {
+    return userspace_cycle_get_32();
+  }
+#endif  // CONFIG_USERSPACE
+  return k_cycle_get_32();
+}
+
+// Accumulates cycle counts and reports min/avg/max in a machine-readable format:
+// ZPP_BENCH suite=<suite> name=<name> unit=cycles n=<n> min=<min> avg=<avg> max=<max>
+class CycleStats {
+public:
+  void add(uint32_t cycles) {
+    _count++;
+    _sum += cycles;
+    _min = cycles < _min ? cycles : _min;
+    _max = cycles > _max ? cycles : _max;
+  }
+
+  [[nodiscard]] uint32_t count() const {
+    return _count;
+  }
+  [[nodiscard]] uint32_t min() const {
+    return _count == 0 ? 0 : _min;
+  }
+  [[nodiscard]] uint32_t max() const {
+    return _max;
+  }
+  [[nodiscard]] uint32_t avg() const {
+    return _count == 0 ? 0 : static_cast<uint32_t>(_sum / _count);
+  }
+
+  void report(const char* suite, const char* name) const {
+    printk("ZPP_BENCH suite=%s name=%s unit=cycles n=%u min=%u avg=%u max=%u\n", suite, name, _count, min(), avg(), max());
+  }
+
+private:
+  uint32_t _count = 0;
+  uint64_t _sum   = 0;
+  uint32_t _min   = std::numeric_limits<uint32_t>::max();
+  uint32_t _max   = 0;
+};
+
+// Runs the function nbr_of_iterations times and returns the cycles spent per call
+template <typename F>
+CycleStats measure(uint32_t nbr_of_iterations, F&& f) {
+  CycleStats stats;
+  for (uint32_t i = 0; i < nbr_of_iterations; i++) {
+    uint32_t start = cycles_now();
+    f();
+    stats.add(cycles_now() - start);
+  }
+  return stats;
+}
+
+// Runs a producer thread sending the sequence numbers 0 to nbr_of_items - 1 with send,
+// receives them with receive and returns the average number of cycles per item
+template <typename SendF, typename ReceiveF>
+uint32_t measure_transfer(uint32_t nbr_of_items, SendF send, ReceiveF receive) {
+  zpp_lib::Thread producer(zpp_lib::PreemptableThreadPriority::PriorityNormal, "producer");
+  uint32_t start_cycles = cycles_now();
+  auto res              = producer.start([&send, nbr_of_items]() {
+    for (uint32_t i = 0; i < nbr_of_items; i++) {
+      send(i);
+    }
+  });
+  zpp_zassert_true(res, "Cannot start producer");
+  for (uint32_t i = 0; i < nbr_of_items; i++) {
+    zpp_zassert_equal(receive(), i, "Wrong item received");
+  }
+  uint32_t elapsed_cycles = cycles_now() - start_cycles;
+  zpp_zassert_true(producer.join(), "Cannot join producer");
+  return elapsed_cycles / nbr_of_items;
+}
+
+// Reports a single value in the same format as CycleStats (e.g. a size in bytes)
+inline void report_value(const char* suite, const char* name, const char* unit, size_t value) {
+  printk("ZPP_BENCH suite=%s name=%s unit=%s value=%zu\n", suite, name, unit, value);
+}
+
+}  // namespace zpp_lib::benchmark
@@ -0,0 +1,159 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_condition_variable.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib ConditionVariable class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+#include <chrono>
+#include <mutex>
+
+// zephyr
+#include <zephyr/kernel.h>
+#if CONFIG_USERSPACE
+#include <zephyr/app_memory/app_memdomain.h>
+#endif  // CONFIG_USERSPACE
+
+// zpp_rtos
+#include "zpp_include/condition_variable.hpp"
+#include "zpp_include/mutex.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+#if CONFIG_USERSPACE
+// partition of the zpp_lib data, to be added to the memory domain of user threads
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+K_APPMEM_PARTITION_DEFINE(zpp_lib_partition);
+#endif  // CONFIG_USERSPACE
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+
+constexpr uint32_t kNbrOfItems  = 100;
+constexpr uint8_t kNbrOfWaiters = 3;
+constexpr auto kTimeout         = 5ms;
+
+void* suite_setup() {
+#if CONFIG_USERSPACE
+  auto ret = k_mem_domain_add_partition(&k_mem_domain_default, &zpp_lib_partition);
+  zpp_zassert_equal(ret, 0, "Cannot add zpp_lib partition: %d", ret);
+#endif  // CONFIG_USERSPACE
+  return nullptr;
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_condition_variable, test_timeout) {
+  zpp_lib::Mutex mutex;
+  zpp_lib::ConditionVariable cv;
+  std::unique_lock<zpp_lib::Mutex> lock(mutex);
+
+  // TESTPOINT: waits that are not notified expire without error, with the mutex owned
+  auto res = cv.wait_for(lock, kTimeout);
+  zpp_zassert_true(!res.has_error() && !res, "Wait not expired");
+  res = cv.wait_for(lock, kTimeout, []() { return false; });
+  zpp_zassert_true(!res.has_error() && !res, "Wait with false predicate not expired");
+  zpp_zassert_true(lock.owns_lock(), "Mutex not owned after the wait");
+
+  // TESTPOINT: a true predicate returns without waiting
+  std::chrono::milliseconds now(k_uptime_get());
+  res = cv.wait_until(lock, now + kTimeout, []() { return true; });
+  zpp_zassert_true(!res.has_error() && res, "Wait with true predicate failed");
+}
+
+ZPP_ZTEST(zpp_condition_variable, test_producer_consumer) {
+  // TESTPOINT: a consumer waiting on a predicate gets all items of a producer
+  zpp_lib::Mutex mutex;
+  zpp_lib::ConditionVariable cv;
+  uint32_t nbr_of_available = 0;
+  uint32_t nbr_of_produced  = 0;
+#if CONFIG_USERSPACE
+  zpp_lib::Thread producer(zpp_lib::PreemptableThreadPriority::PriorityNormal, "producer", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread producer(zpp_lib::PreemptableThreadPriority::PriorityNormal, "producer");
+#endif  // CONFIG_USERSPACE
+  auto ret = producer.start([&mutex, &cv, &nbr_of_available, &nbr_of_produced]() {
+    for (uint32_t i = 0; i < kNbrOfItems; i++) {
+      {
+        std::scoped_lock<zpp_lib::Mutex> guard(mutex);
+        nbr_of_available++;
+        nbr_of_produced++;
+      }
+      cv.notify_one();
+      if (i % 10 == 0) {
+        k_yield();
+      }
+    }
+  });
+  zpp_zassert_true(ret);
+
+  uint32_t nbr_of_consumed = 0;
+  while (nbr_of_consumed < kNbrOfItems) {
+    std::unique_lock<zpp_lib::Mutex> lock(mutex);
+    zpp_zassert_true(cv.wait(lock, [&nbr_of_available]() { return nbr_of_available > 0; }));
+    nbr_of_consumed += nbr_of_available;
+    nbr_of_available = 0;
+  }
+  zpp_zassert_true(producer.join());
+  zpp_zassert_equal(nbr_of_consumed, nbr_of_produced, "Items lost");
+}
+
+ZPP_ZTEST(zpp_condition_variable, test_notify_all) {
+  // TESTPOINT: all waiting threads are woken up by notify_all
+  zpp_lib::Mutex mutex;
+  zpp_lib::ConditionVariable cv;
+  bool is_ready         = false;
+  uint32_t nbr_of_woken = 0;
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread0(zpp_lib::PreemptableThreadPriority::PriorityNormal, "waiter0", false);
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "waiter1", false);
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "waiter2", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread0(zpp_lib::PreemptableThreadPriority::PriorityNormal, "waiter0");
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "waiter1");
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "waiter2");
+#endif  // CONFIG_USERSPACE
+  std::array<zpp_lib::Thread*, kNbrOfWaiters> threads = {&thread0, &thread1, &thread2};
+  for (auto* p_thread : threads) {
+    auto ret = p_thread->start([&mutex, &cv, &is_ready, &nbr_of_woken]() {
+      std::unique_lock<zpp_lib::Mutex> lock(mutex);
+      zpp_zassert_true(cv.wait(lock, [&is_ready]() { return is_ready; }));
+      nbr_of_woken++;
+    });
+    zpp_zassert_true(ret, "Cannot start waiter");
+  }
+  // let the waiters block on the condition variable
+  k_msleep(10);
+  {
+    std::scoped_lock<zpp_lib::Mutex> guard(mutex);
+    is_ready = true;
+  }
+  cv.notify_all();
+  for (auto* p_thread : threads) {
+    zpp_zassert_true(p_thread->join(), "Cannot join waiter");
+  }
+  zpp_zassert_equal(nbr_of_woken, kNbrOfWaiters, "Not all waiters woken up");
+}
+
+ZPP_ZTEST_SUITE(zpp_condition_variable, nullptr, suite_setup, nullptr, nullptr, nullptr);
@@ -0,0 +1,105 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_event.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib Event class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <chrono>
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// zpp_rtos
+#include "zpp_include/event.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+
+constexpr uint32_t kFlagA = BIT(0);
+constexpr uint32_t kFlagB = BIT(1);
+constexpr uint32_t kFlagC = BIT(2);
+constexpr auto kTimeout   = 5ms;
+
+// event posted by the timer ISR
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+zpp_lib::Event* s_p_event = nullptr;
+
+void timer_expiry(struct k_timer* /*timer*/) {
+  // two sources signal their events before the waiting thread runs
+  s_p_event->set(kFlagA);
+  s_p_event->set(kFlagC);
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_event, test_matched_flags) {
+  zpp_lib::Event event;
+
+  // TESTPOINT: the wait returns all matched flags and clears them
+  event.set(kFlagA);
+  event.set(kFlagB);
+  auto matched_flags = event.wait_any(kFlagA | kFlagB | kFlagC);
+  zpp_zassert_equal(matched_flags, kFlagA | kFlagB, "Wrong matched flags");
+  auto res = event.try_wait_any_for(kTimeout, kFlagA | kFlagB | kFlagC);
+  zpp_zassert_true(!res.has_error() && !res, "Matched flags not cleared");
+
+  // TESTPOINT: flags that are not waited on are kept
+  event.set(kFlagA | kFlagC);
+  matched_flags = event.wait_any(kFlagA);
+  zpp_zassert_equal(matched_flags, kFlagA, "Wrong matched flags");
+  res = event.try_wait_any_for(kTimeout, kFlagB | kFlagC, matched_flags);
+  zpp_zassert_true(!res.has_error() && res, "Flag not waited on was cleared");
+  zpp_zassert_equal(matched_flags, kFlagC, "Wrong matched flags");
+}
+
+ZPP_ZTEST(zpp_event, test_wait_all) {
+  zpp_lib::Event event;
+
+  // TESTPOINT: waiting for all flags expires if one of them is not set, the set flags are kept
+  event.set(kFlagA);
+  auto res = event.try_wait_all_for(kTimeout, kFlagA | kFlagB);
+  zpp_zassert_true(!res.has_error() && !res, "Wait for all flags returned with one flag");
+
+  // TESTPOINT: waiting for all flags returns once all of them are set
+  event.set(kFlagB);
+  auto matched_flags = event.wait_all(kFlagA | kFlagB);
+  zpp_zassert_equal(matched_flags, kFlagA | kFlagB, "Wrong matched flags");
+}
+
+ZPP_ZTEST(zpp_event, test_dispatch_in_one_wake_up) {
+  // TESTPOINT: all flags posted by an ISR before the waiting thread runs are handled
+  // in a single wake-up
+  zpp_lib::Event event;
+  s_p_event = &event;
+  struct k_timer timer;
+  k_timer_init(&timer, timer_expiry, nullptr);
+  k_timer_start(&timer, K_MSEC(1), K_NO_WAIT);
+  auto matched_flags = event.wait_any(kFlagA | kFlagB | kFlagC);
+  k_timer_stop(&timer);
+  zpp_zassert_equal(matched_flags, kFlagA | kFlagC, "Flags not handled in one wake-up");
+  s_p_event = nullptr;
+}
+
+ZPP_ZTEST_SUITE(zpp_event, nullptr, nullptr, nullptr, nullptr, nullptr);
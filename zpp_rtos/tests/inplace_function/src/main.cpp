@@ -0,0 +1,212 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_inplace_function.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib InplaceFunction class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/sys/sys_heap.h>
+
+// std
+#include <functional>
+#include <utility>
+
+// zpp_rtos
+#include "zpp_include/inplace_function.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_log.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+// test helpers
+#include "zpp_benchmark.hpp"
+
+ZPP_LOG_MODULE_REGISTER(test_inplace_function, CONFIG_APP_LOG_LEVEL);
+
+extern "C" {
+// Zephyr system heap, used by operator new
+// NOLINTNEXTLINE(readability-identifier-naming)
+extern struct sys_heap _system_heap;
+}
+
+namespace {
+
+constexpr auto kSuiteName              = "inplace_function";
+constexpr uint32_t kNbrOfIterations    = 1000;
+constexpr size_t kLargeCaptureCapacity = 64;
+constexpr uint32_t kLargeCaptureLength = 6;
+
+// counts constructions and destructions, for checking the lifetime of captured objects
+struct LifetimeCounter {
+  static inline int s_nbr_of_instances = 0;
+  LifetimeCounter() {
+    s_nbr_of_instances++;
+  }
+  LifetimeCounter(const LifetimeCounter&) {
+    s_nbr_of_instances++;
+  }
+  LifetimeCounter(LifetimeCounter&&) noexcept {
+    s_nbr_of_instances++;
+  }
+  LifetimeCounter& operator=(const LifetimeCounter&) = default;
+  LifetimeCounter& operator=(LifetimeCounter&&)      = default;
+  ~LifetimeCounter() {
+    s_nbr_of_instances--;
+  }
+};
+
+// a capture that does not fit in the small buffer of std::function
+struct LargeCapture {
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+  uint32_t values[kLargeCaptureLength] = {1, 2, 3, 4, 5, 6};
+};
+
+int add_one(int value) {
+  return value + 1;
+}
+
+size_t heap_allocated_bytes() {
+  struct sys_memory_stats stats = {};
+  sys_heap_runtime_stats_get(&_system_heap, &stats);
+  return stats.allocated_bytes;
+}
+
+// prevent the compiler from optimizing the benchmarked calls
+volatile uint32_t s_sink = 0;  // MISRA-suppress: 6.2.1  use of volatile for preventing
+                               // compiler optimization
+
+}  // namespace
+
+ZPP_ZTEST_USER(zpp_inplace_function, test_empty) {
+  // TESTPOINT: default constructed and null function pointers are empty
+  zpp_lib::InplaceFunction<void()> f;
+  zpp_zassert_true(f == nullptr, "Default constructed function is not empty");
+  zpp_zassert_true(!f, "Default constructed function converts to true");
+
+  int (*p_function)(int) = nullptr;
+  zpp_lib::InplaceFunction<int(int)> g(p_function);
+  zpp_zassert_true(g == nullptr, "Function built from a null pointer is not empty");
+
+  g = add_one;
+  zpp_zassert_true(g != nullptr, "Function built from a function pointer is empty");
+  g = nullptr;
+  zpp_zassert_true(g == nullptr, "Function assigned to nullptr is not empty");
+}
+
+ZPP_ZTEST_USER(zpp_inplace_function, test_invoke) {
+  // TESTPOINT: function pointers and lambdas are invoked with their arguments
+  zpp_lib::InplaceFunction<int(int)> f = add_one;
+  zpp_zassert_equal(f(1), 2, "Wrong result from function pointer");
+
+  int offset = 10;
+  f          = [offset](int value) { return value + offset; };
+  zpp_zassert_equal(f(1), 11, "Wrong result from capturing lambda");
+
+  // TESTPOINT: the state of a mutable lambda is kept between calls
+  zpp_lib::InplaceFunction<int()> counter = [count = 0]() mutable { return ++count; };
+  counter();
+  zpp_zassert_equal(counter(), 2, "State of mutable lambda is not kept");
+}
+
+ZPP_ZTEST_USER(zpp_inplace_function, test_copy_move) {
+  // TESTPOINT: copies own their captured state and moved from functions are empty
+  zpp_lib::InplaceFunction<int()> f = [count = 0]() mutable { return ++count; };
+  f();
+  zpp_lib::InplaceFunction<int()> copy = f;
+  zpp_zassert_equal(copy(), 2, "Copy did not copy the captured state");
+  zpp_zassert_equal(f(), 2, "Copy shares the captured state");
+
+  zpp_lib::InplaceFunction<int()> moved = std::move(f);
+  zpp_zassert_true(f == nullptr, "Moved from function is not empty");  // NOLINT(bugprone-use-after-move)
+  zpp_zassert_equal(moved(), 3, "Move did not move the captured state");
+}
+
+ZPP_ZTEST(zpp_inplace_function, test_lifetime) {
+  // TESTPOINT: captured objects are destroyed with the function or on reassignment
+  LifetimeCounter::s_nbr_of_instances = 0;
+  {
+    LifetimeCounter counter;
+    zpp_lib::InplaceFunction<void()> f = [counter]() {};
+    zpp_lib::InplaceFunction<void()> g = f;
+    zpp_lib::InplaceFunction<void()> h = std::move(g);
+    zpp_zassert_equal(LifetimeCounter::s_nbr_of_instances, 3, "Wrong number of captured instances");
+    f = nullptr;
+    zpp_zassert_equal(LifetimeCounter::s_nbr_of_instances, 2, "Captured instance not destroyed on reset");
+  }
+  zpp_zassert_equal(LifetimeCounter::s_nbr_of_instances, 0, "Captured instances leaked");
+}
+
+ZPP_ZTEST(zpp_inplace_function, test_no_heap) {
+  // TESTPOINT: a large capture is allocated on the heap by std::function, but not by InplaceFunction
+  LargeCapture capture;
+  size_t allocated_bytes = heap_allocated_bytes();
+  {
+    zpp_lib::InplaceFunction<uint32_t(), kLargeCaptureCapacity> f = [capture]() { return capture.values[0]; };
+    zpp_zassert_equal(heap_allocated_bytes(), allocated_bytes, "InplaceFunction allocated from the heap");
+    s_sink = f();
+  }
+  {
+    std::function<uint32_t()> f = [capture]() { return capture.values[0]; };
+    zpp_zassert_true(heap_allocated_bytes() > allocated_bytes, "std::function did not allocate from the heap");
+    s_sink = f();
+  }
+  zpp_zassert_equal(heap_allocated_bytes(), allocated_bytes, "Heap memory leaked");
+}
+
+ZPP_ZTEST(zpp_inplace_function, test_benchmark_size) {
+  // report the footprint of both callable types
+  zpp_lib::benchmark::report_value(kSuiteName, "sizeof_std_function", "bytes", sizeof(std::function<void()>));
+  zpp_lib::benchmark::report_value(kSuiteName, "sizeof_inplace_function", "bytes", sizeof(zpp_lib::InplaceFunction<void()>));
+  zpp_lib::benchmark::report_value(
+      kSuiteName, "sizeof_inplace_function_large", "bytes", sizeof(zpp_lib::InplaceFunction<void(), kLargeCaptureCapacity>));
+}
+
+ZPP_ZTEST(zpp_inplace_function, test_benchmark_cycles) {
+  // compare the cost of constructing and invoking both callable types
+  uint32_t value = 1;
+  zpp_lib::benchmark::measure(kNbrOfIterations, [&value]() {
+    std::function<uint32_t()> f = [&value]() { return value; };
+    s_sink                      = f();
+  }).report(kSuiteName, "std_function_small_capture");
+  zpp_lib::benchmark::measure(kNbrOfIterations, [&value]() {
+    zpp_lib::InplaceFunction<uint32_t()> f = [&value]() { return value; };
+    s_sink                                 = f();
+  }).report(kSuiteName, "inplace_function_small_capture");
+
+  LargeCapture capture;
+  zpp_lib::benchmark::measure(kNbrOfIterations, [&capture]() {
+    std::function<uint32_t()> f = [capture]() { return capture.values[0]; };
+    s_sink                      = f();
+  }).report(kSuiteName, "std_function_large_capture");
+  zpp_lib::benchmark::measure(kNbrOfIterations, [&capture]() {
+    zpp_lib::InplaceFunction<uint32_t(), kLargeCaptureCapacity> f = [capture]() { return capture.values[0]; };
+    s_sink                                                         = f();
+  }).report(kSuiteName, "inplace_function_large_capture");
+
+  // invocation only
+  std::function<uint32_t()> std_function                = [&value]() { return value; };
+  zpp_lib::InplaceFunction<uint32_t()> inplace_function = [&value]() { return value; };
+  zpp_lib::benchmark::measure(kNbrOfIterations, [&std_function]() { s_sink = std_function(); })
+      .report(kSuiteName, "std_function_invoke");
+  zpp_lib::benchmark::measure(kNbrOfIterations, [&inplace_function]() { s_sink = inplace_function(); })
+      .report(kSuiteName, "inplace_function_invoke");
+}
+
+ZPP_ZTEST_SUITE(zpp_inplace_function, nullptr, nullptr, nullptr, nullptr, nullptr);
@@ -0,0 +1,154 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_kernel_object_pool.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib KernelObjectPool class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+
+// zephyr
+#include <zephyr/kernel.h>
+#if CONFIG_USERSPACE
+#include <zephyr/app_memory/app_memdomain.h>
+#endif  // CONFIG_USERSPACE
+
+// zpp_rtos
+#include "zpp_include/kernel_object_pool.hpp"
+#include "zpp_include/mutex.hpp"
+#include "zpp_include/semaphore.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+#if CONFIG_USERSPACE
+// partition of the zpp_lib data, to be added to the memory domain of user threads
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+K_APPMEM_PARTITION_DEFINE(zpp_lib_partition);
+#endif  // CONFIG_USERSPACE
+
+namespace {
+
+// the pool spans more than one word of the bitmap
+constexpr size_t kPoolSize           = 40;
+constexpr uint32_t kNbrOfAllocations = 500;
+constexpr uint8_t kNbrOfAllocators   = 2;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<struct k_sem, kPoolSize> s_semaphores = {};
+zpp_lib::KernelObjectPool<struct k_sem, kPoolSize> s_pool([](size_t index) { return &s_semaphores[index]; });
+// owner of each object of the pool, for detecting objects allocated twice
+std::array<atomic_t, kPoolSize> s_owners = {};
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+void allocate_and_free(uint8_t owner) {
+  for (uint32_t i = 0; i < kNbrOfAllocations; i++) {
+    size_t index   = zpp_lib::kInvalidPoolIndex;
+    auto* p_object = s_pool.allocate(index);
+    zpp_zassert_true(p_object != nullptr && index < kPoolSize, "Allocation failed");
+    zpp_zassert_true(atomic_cas(&s_owners[index], 0, owner), "Object %d allocated twice", index);
+    k_yield();
+    zpp_zassert_true(atomic_cas(&s_owners[index], owner, 0), "Object %d allocated twice", index);
+    s_pool.free(index);
+  }
+}
+
+void* suite_setup() {
+#if CONFIG_USERSPACE
+  auto ret = k_mem_domain_add_partition(&k_mem_domain_default, &zpp_lib_partition);
+  zpp_zassert_equal(ret, 0, "Cannot add zpp_lib partition: %d", ret);
+#endif  // CONFIG_USERSPACE
+  return nullptr;
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_kernel_object_pool, test_allocate_free) {
+  // TESTPOINT: all objects of the pool can be allocated once, then allocation fails
+  std::array<size_t, kPoolSize> indexes = {};
+  for (size_t i = 0; i < kPoolSize; i++) {
+    auto* p_object = s_pool.allocate(indexes[i]);
+    zpp_zassert_true(p_object != nullptr, "Allocation %d failed", i);
+    zpp_zassert_true(p_object == s_pool.get(indexes[i]), "Wrong object for index %d", indexes[i]);
+    zpp_zassert_equal(s_pool.index_of(p_object), indexes[i], "Wrong index for object %d", i);
+    for (size_t j = 0; j < i; j++) {
+      zpp_zassert_true(indexes[i] != indexes[j], "Index %d allocated twice", indexes[i]);
+    }
+  }
+  size_t index   = 0;
+  auto* p_object = s_pool.allocate(index);
+  zpp_zassert_true(p_object == nullptr && index == zpp_lib::kInvalidPoolIndex, "Allocation in a full pool");
+
+  auto stats = s_pool.get_stats();
+  zpp_zassert_equal(stats.size, kPoolSize, "Wrong pool size");
+  zpp_zassert_equal(stats.nbr_of_used, kPoolSize, "Wrong number of used objects");
+  zpp_zassert_equal(stats.max_nbr_of_used, kPoolSize, "Wrong max number of used objects");
+  zpp_zassert_equal(stats.nbr_of_failures, 1, "Wrong number of failures");
+
+  // TESTPOINT: a freed object can be allocated again
+  s_pool.free(indexes[kPoolSize / 2]);
+  p_object = s_pool.allocate(index);
+  zpp_zassert_true(p_object != nullptr && index == indexes[kPoolSize / 2], "Freed object not allocated again");
+
+  // TESTPOINT: freeing an invalid index has no effect
+  s_pool.free(zpp_lib::kInvalidPoolIndex);
+  for (auto allocated_index : indexes) {
+    s_pool.free(allocated_index);
+  }
+  stats = s_pool.get_stats();
+  zpp_zassert_equal(stats.nbr_of_used, 0, "Objects not freed");
+  zpp_zassert_equal(stats.max_nbr_of_used, kPoolSize, "Wrong max number of used objects");
+}
+
+ZPP_ZTEST(zpp_kernel_object_pool, test_concurrent_allocations) {
+  // TESTPOINT: threads allocating and freeing concurrently never get the same object
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "allocator1", false);
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "allocator2", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "allocator1");
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "allocator2");
+#endif  // CONFIG_USERSPACE
+  zpp_zassert_true(thread1.start([]() { allocate_and_free(1); }));
+  zpp_zassert_true(thread2.start([]() { allocate_and_free(kNbrOfAllocators); }));
+  zpp_zassert_true(thread1.join());
+  zpp_zassert_true(thread2.join());
+  zpp_zassert_equal(s_pool.get_stats().nbr_of_used, 0, "Objects not freed");
+}
+
+#if CONFIG_USERSPACE
+ZPP_ZTEST_USER(zpp_kernel_object_pool, test_library_pools) {
+  // TESTPOINT: the statistics of the zpp_lib pools follow the construction and the
+  // destruction of objects, also in user mode
+  auto nbr_of_mutexes    = zpp_lib::Mutex::get_pool_stats().nbr_of_used;
+  auto nbr_of_semaphores = zpp_lib::Semaphore::get_pool_stats().nbr_of_used;
+  {
+    zpp_lib::Mutex mutex;
+    zpp_lib::Semaphore semaphore(0, 1);
+    zpp_zassert_equal(zpp_lib::Mutex::get_pool_stats().nbr_of_used, nbr_of_mutexes + 1, "Mutex not allocated");
+    zpp_zassert_equal(zpp_lib::Semaphore::get_pool_stats().nbr_of_used, nbr_of_semaphores + 1, "Semaphore not allocated");
+  }
+  zpp_zassert_equal(zpp_lib::Mutex::get_pool_stats().nbr_of_used, nbr_of_mutexes, "Mutex not freed");
+  zpp_zassert_equal(zpp_lib::Semaphore::get_pool_stats().nbr_of_used, nbr_of_semaphores, "Semaphore not freed");
+}
+#endif  // CONFIG_USERSPACE
+
+ZPP_ZTEST_SUITE(zpp_kernel_object_pool, nullptr, suite_setup, nullptr, nullptr, nullptr);
@@ -0,0 +1,138 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_message_queue.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib MessageQueue class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+#include <chrono>
+#include <span>
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// zpp_rtos
+#include "zpp_include/message_queue.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+// test helpers
+#include "zpp_benchmark.hpp"
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""s;
+
+constexpr auto kSuiteName        = "message_queue";
+constexpr uint32_t kQueueSize    = 8;
+constexpr uint32_t kBurstSize    = 8;
+constexpr uint32_t kNbrOfBursts  = 50;
+constexpr auto kTimeout          = 5ms;
+constexpr auto kBenchmarkTimeout = 100ms;
+
+using Queue = zpp_lib::MessageQueue<uint32_t, kQueueSize>;
+
+// runs a producer thread sending kNbrOfBursts bursts of kBurstSize sequence numbers,
+// receives them with receive and reports the average number of cycles per message and
+// the number of receive calls
+template <typename ReceiveF> void measure_bursts(Queue& queue, const char* name, ReceiveF receive) {
+  zpp_lib::Thread producer(zpp_lib::PreemptableThreadPriority::PriorityNormal, "producer");
+  uint32_t start_cycles = zpp_lib::benchmark::cycles_now();
+  auto res              = producer.start([&queue]() {
+    std::array<uint32_t, kBurstSize> burst = {};
+    for (uint32_t i = 0; i < kNbrOfBursts; i++) {
+      for (uint32_t j = 0; j < kBurstSize; j++) {
+        burst[j] = (i * kBurstSize) + j;
+      }
+      size_t nbr_of_put = 0;
+      zpp_zassert_true(queue.try_put_n_for(1s, burst, nbr_of_put) && nbr_of_put == kBurstSize, "Cannot put burst");
+      k_msleep(1);
+    }
+  });
+  zpp_zassert_true(res, "Cannot start producer");
+  uint32_t nbr_of_received = 0;
+  uint32_t nbr_of_calls    = 0;
+  while (nbr_of_received < kNbrOfBursts * kBurstSize) {
+    nbr_of_received = receive(nbr_of_received);
+    nbr_of_calls++;
+  }
+  uint32_t elapsed_cycles = zpp_lib::benchmark::cycles_now() - start_cycles;
+  zpp_zassert_true(producer.join(), "Cannot join producer");
+  zpp_lib::benchmark::report_value(kSuiteName, name, "cycles", elapsed_cycles / nbr_of_received);
+  zpp_lib::benchmark::report_value(kSuiteName, name, "calls", nbr_of_calls);
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_message_queue, test_put_get_n) {
+  Queue queue;
+  std::array<uint32_t, kQueueSize + 2> messages = {};
+  std::array<uint32_t, kQueueSize + 2> received = {};
+  for (uint32_t i = 0; i < messages.size(); i++) {
+    messages[i] = i;
+  }
+
+  // TESTPOINT: messages put in one call are got in order over several calls
+  size_t nbr_of_messages = 0;
+  auto res               = queue.try_put_n_for(0ms, std::span<const uint32_t>(messages.data(), 5), nbr_of_messages);
+  zpp_zassert_true(!res.has_error() && res && nbr_of_messages == 5, "Wrong number of messages put");
+  res = queue.try_get_n_for(kTimeout, std::span<uint32_t>(received.data(), 3), nbr_of_messages);
+  zpp_zassert_true(!res.has_error() && res && nbr_of_messages == 3, "Wrong number of messages got");
+  zpp_zassert_equal(queue.drain_into(std::span<uint32_t>(&received[3], received.size() - 3)), 2, "Wrong number of messages drained");
+  for (uint32_t i = 0; i < 5; i++) {
+    zpp_zassert_equal(received[i], i, "Wrong message got");
+  }
+
+  // TESTPOINT: a batch larger than the free space is put partially
+  res = queue.try_put_n_for(0ms, messages, nbr_of_messages);
+  zpp_zassert_true(!res.has_error() && res && nbr_of_messages == kQueueSize, "Wrong number of messages put");
+  zpp_zassert_equal(queue.drain_into(received), kQueueSize, "Wrong number of messages drained");
+
+  // TESTPOINT: getting from an empty queue expires
+  res = queue.try_get_n_for(kTimeout, received, nbr_of_messages);
+  zpp_zassert_true(!res.has_error() && !res && nbr_of_messages == 0, "Messages got from an empty queue");
+  zpp_zassert_equal(queue.drain_into(received), 0, "Messages drained from an empty queue");
+}
+
+ZPP_ZTEST(zpp_message_queue, test_benchmark_bursts) {
+  // compare a consumer getting messages one by one with a consumer getting whole bursts
+  Queue queue;
+  measure_bursts(queue, "get", [&queue](uint32_t nbr_of_received) {
+    uint32_t message = 0;
+    zpp_zassert_true(queue.try_get_for(kBenchmarkTimeout, message), "No message received");
+    zpp_zassert_equal(message, nbr_of_received, "Wrong message received");
+    return nbr_of_received + 1;
+  });
+  measure_bursts(queue, "get_n", [&queue](uint32_t nbr_of_received) {
+    std::array<uint32_t, kBurstSize> messages = {};
+    size_t nbr_of_messages                    = 0;
+    zpp_zassert_true(queue.try_get_n_for(kBenchmarkTimeout, messages, nbr_of_messages), "No message received");
+    for (size_t i = 0; i < nbr_of_messages; i++) {
+      zpp_zassert_equal(messages[i], nbr_of_received + i, "Wrong message received");
+    }
+    return nbr_of_received + static_cast<uint32_t>(nbr_of_messages);
+  });
+}
+
+ZPP_ZTEST_SUITE(zpp_message_queue, nullptr, nullptr, nullptr, nullptr, nullptr);
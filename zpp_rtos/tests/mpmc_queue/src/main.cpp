@@ -0,0 +1,185 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_mpmc_queue.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib MpmcQueue class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+#include <chrono>
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+// zpp_rtos
+#include "zpp_include/message_queue.hpp"
+#include "zpp_include/mpmc_queue.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+// test helpers
+#include "zpp_benchmark.hpp"
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""s;
+
+constexpr auto kSuiteName                 = "mpmc_queue";
+constexpr size_t kQueueSize               = 16;
+constexpr size_t kMaxNbrOfPairs           = 4;
+constexpr uint32_t kNbrOfItemsPerProducer = 500;
+constexpr uint32_t kNbrOfItems            = kMaxNbrOfPairs * kNbrOfItemsPerProducer;
+constexpr auto kTimeout                   = 1s;
+
+// benchmark names for 1 to kMaxNbrOfPairs producer/consumer pairs
+constexpr std::array<const char*, kMaxNbrOfPairs> kMpmcQueueNames    = {
+    "mpmc_queue_transfer_1", "mpmc_queue_transfer_2", "mpmc_queue_transfer_3", "mpmc_queue_transfer_4"};
+constexpr std::array<const char*, kMaxNbrOfPairs> kMessageQueueNames = {
+    "message_queue_transfer_1", "message_queue_transfer_2", "message_queue_transfer_3", "message_queue_transfer_4"};
+
+using Queue = zpp_lib::MpmcQueue<uint32_t, kQueueSize>;
+
+// set for each item received by any consumer
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+ATOMIC_DEFINE(s_received_items, kNbrOfItems);
+atomic_t s_nbr_of_duplicates = ATOMIC_INIT(0);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+// runs nbr_of_pairs producer threads, each sending kNbrOfItemsPerProducer distinct items
+// with push, and as many consumer threads receiving them with pop. Returns the average
+// number of cycles per item.
+template <typename PushF, typename PopF>
+uint32_t measure_transfer(size_t nbr_of_pairs, PushF push, PopF pop) {
+  zpp_lib::Thread producer0(zpp_lib::PreemptableThreadPriority::PriorityNormal, "producer0");
+  zpp_lib::Thread producer1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "producer1");
+  zpp_lib::Thread producer2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "producer2");
+  zpp_lib::Thread producer3(zpp_lib::PreemptableThreadPriority::PriorityNormal, "producer3");
+  zpp_lib::Thread consumer0(zpp_lib::PreemptableThreadPriority::PriorityNormal, "consumer0");
+  zpp_lib::Thread consumer1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "consumer1");
+  zpp_lib::Thread consumer2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "consumer2");
+  zpp_lib::Thread consumer3(zpp_lib::PreemptableThreadPriority::PriorityNormal, "consumer3");
+  std::array<zpp_lib::Thread*, kMaxNbrOfPairs> producers = {&producer0, &producer1, &producer2, &producer3};
+  std::array<zpp_lib::Thread*, kMaxNbrOfPairs> consumers = {&consumer0, &consumer1, &consumer2, &consumer3};
+
+  for (auto& word : s_received_items) {
+    atomic_clear(&word);
+  }
+  atomic_clear(&s_nbr_of_duplicates);
+  uint32_t start_cycles = zpp_lib::benchmark::cycles_now();
+  for (size_t i = 0; i < nbr_of_pairs; i++) {
+    // each consumer receives as many items as a producer sends, from any producer
+    auto res = consumers[i]->start([&pop]() {
+      for (uint32_t j = 0; j < kNbrOfItemsPerProducer; j++) {
+        if (atomic_test_and_set_bit(s_received_items, pop())) {
+          atomic_inc(&s_nbr_of_duplicates);
+        }
+      }
+    });
+    zpp_zassert_true(res, "Cannot start consumer %zu", i);
+    res = producers[i]->start([&push, i]() {
+      for (uint32_t j = 0; j < kNbrOfItemsPerProducer; j++) {
+        push(static_cast<uint32_t>(i * kNbrOfItemsPerProducer + j));
+      }
+    });
+    zpp_zassert_true(res, "Cannot start producer %zu", i);
+  }
+  for (size_t i = 0; i < nbr_of_pairs; i++) {
+    zpp_zassert_true(producers[i]->join(), "Cannot join producer %zu", i);
+    zpp_zassert_true(consumers[i]->join(), "Cannot join consumer %zu", i);
+  }
+  uint32_t elapsed_cycles = zpp_lib::benchmark::cycles_now() - start_cycles;
+
+  // all items are received exactly once
+  zpp_zassert_equal(atomic_get(&s_nbr_of_duplicates), 0, "Items received several times");
+  for (uint32_t item = 0; item < nbr_of_pairs * kNbrOfItemsPerProducer; item++) {
+    zpp_zassert_true(atomic_test_bit(s_received_items, item), "Item %d not received", item);
+  }
+  return elapsed_cycles / (nbr_of_pairs * kNbrOfItemsPerProducer);
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_mpmc_queue, test_push_pop) {
+  Queue queue;
+
+  // TESTPOINT: the queue holds capacity() items, in FIFO order, also across the end of
+  // the buffer
+  for (uint32_t round = 0; round < 3; round++) {
+    for (uint32_t i = 0; i < Queue::capacity(); i++) {
+      zpp_zassert_true(queue.try_push(i), "Cannot push item %d", i);
+    }
+    zpp_zassert_true(!queue.try_push(0), "Item pushed in a full queue");
+    zpp_zassert_equal(queue.size(), Queue::capacity(), "Wrong queue size");
+    uint32_t item = 0;
+    for (uint32_t i = 0; i < Queue::capacity(); i++) {
+      zpp_zassert_true(queue.try_pop(item) && item == i, "Wrong item popped");
+    }
+    zpp_zassert_true(!queue.try_pop(item) && queue.empty(), "Item popped from an empty queue");
+    // shift the positions for the next round
+    zpp_zassert_true(queue.try_push(0) && queue.try_pop(item), "Cannot transfer item");
+  }
+
+  // TESTPOINT: waiting on an empty or a full queue expires
+  uint32_t item = 0;
+  auto res      = queue.try_pop_for(5ms, item);
+  zpp_zassert_true(!res.has_error() && !res, "Item popped from an empty queue");
+  for (uint32_t i = 0; i < Queue::capacity(); i++) {
+    zpp_zassert_true(queue.try_push(i), "Cannot push item %d", i);
+  }
+  res = queue.try_push_for(5ms, item);
+  zpp_zassert_true(!res.has_error() && !res, "Item pushed in a full queue");
+}
+
+ZPP_ZTEST(zpp_mpmc_queue, test_benchmark_scalability) {
+  // compare the cost of transferring items between 1 to kMaxNbrOfPairs producers and
+  // as many consumers with a lock-free queue and with a message queue of the same size
+  for (size_t nbr_of_pairs = 1; nbr_of_pairs <= kMaxNbrOfPairs; nbr_of_pairs++) {
+    {
+      Queue queue;
+      auto queue_cycles = measure_transfer(
+          nbr_of_pairs,
+          [&queue](uint32_t item) { zpp_zassert_true(queue.try_push_for(kTimeout, item), "Cannot push item"); },
+          [&queue]() {
+            uint32_t item = 0;
+            zpp_zassert_true(queue.try_pop_for(kTimeout, item), "No item received");
+            return item;
+          });
+      zpp_lib::benchmark::report_value(kSuiteName, kMpmcQueueNames[nbr_of_pairs - 1], "cycles", queue_cycles);
+    }
+    {
+      zpp_lib::MessageQueue<uint32_t, kQueueSize> queue;
+      auto queue_cycles = measure_transfer(
+          nbr_of_pairs,
+          [&queue](uint32_t item) { zpp_zassert_true(queue.try_put_for(kTimeout, item), "Cannot put item"); },
+          [&queue]() {
+            uint32_t item = 0;
+            zpp_zassert_true(queue.try_get_for(kTimeout, item), "No item received");
+            return item;
+          });
+      zpp_lib::benchmark::report_value(kSuiteName, kMessageQueueNames[nbr_of_pairs - 1], "cycles", queue_cycles);
+    }
+  }
+}
+
+ZPP_ZTEST_SUITE(zpp_mpmc_queue, nullptr, nullptr, nullptr, nullptr, nullptr);
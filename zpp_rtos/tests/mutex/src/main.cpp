@@ -22,12 +22,56 @@
  * @version 1.0.0
  ***************************************************************************/
 
+// zephyr
+#include <zephyr/kernel.h>
+#if CONFIG_USERSPACE
+#include <zephyr/app_memory/app_memdomain.h>
+#endif  // CONFIG_USERSPACE
+
+// std
+#include <cstring>
+
 // zpp_rtos
 #include "zpp_include/mutex.hpp"
+#include "zpp_include/this_thread.hpp"
 #include "zpp_include/thread.hpp"
+#include "zpp_include/utils.hpp"
 #include "zpp_include/zpp_assert.hpp"
 #include "zpp_include/zpp_test.hpp"
 
+// test helpers
+#include "zpp_benchmark.hpp"
+
+#if CONFIG_USERSPACE
+// partition of the zpp_lib data, to be added to the memory domain of user threads
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+K_APPMEM_PARTITION_DEFINE(zpp_lib_partition);
+#endif  // CONFIG_USERSPACE
+
+namespace {
+
+#if CONFIG_ZPP_MUTEX_FUTEX
+constexpr auto kSuiteName = "mutex_futex";
+#else   // CONFIG_ZPP_MUTEX_FUTEX
+constexpr auto kSuiteName = "mutex";
+#endif  // CONFIG_ZPP_MUTEX_FUTEX
+constexpr uint32_t kNbrOfIterations = 1000;
+
+// k_mutex used directly, as a reference for the benchmark
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+K_MUTEX_DEFINE(s_reference_mutex);
+
+void* suite_setup() {
+#if CONFIG_USERSPACE
+  auto ret = k_mem_domain_add_partition(&k_mem_domain_default, &zpp_lib_partition);
+  zpp_zassert_equal(ret, 0, "Cannot add zpp_lib partition: %d", ret);
+  k_object_access_all_grant(&s_reference_mutex);
+#endif  // CONFIG_USERSPACE
+  return nullptr;
+}
+
+}  // namespace
+
 // test cases
 ZPP_ZTEST_USER(zpp_mutex, test_mutex_lock_unlock) {
   zpp_lib::Mutex mutex;
@@ -44,11 +88,12 @@ ZPP_ZTEST_USER(zpp_mutex, test_mutex_lock_unlock) {
 
   // TESTPOINT: try to lock and unlock mutex in another thread
   static constexpr auto kThreadName = "test_mutex_thread";
-#if CONFIG_USER_SPACE
-  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::Normal, kThreadName, true);
-#else   // CONFIG_USER_SPACE
+#if CONFIG_USERSPACE
+  // the mutex lives on the stack of the test thread, the thread must run in kernel mode
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, kThreadName, false);
+#else   // CONFIG_USERSPACE
   zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, kThreadName);
-#endif  // CONFIG_USER_SPACE
+#endif  // CONFIG_USERSPACE
   auto ret = thread.start([&mutex]() {
     auto bool_ret = mutex.try_lock();
     zpp_zassert_true(!bool_ret.has_error());
@@ -59,4 +104,83 @@ ZPP_ZTEST_USER(zpp_mutex, test_mutex_lock_unlock) {
   zpp_zassert_true(thread.join());
 }
 
-ZPP_ZTEST_SUITE(zpp_mutex, nullptr, nullptr, nullptr, nullptr, nullptr);
+ZPP_ZTEST(zpp_mutex, test_mutex_contended) {
+  // TESTPOINT: threads competing for the mutex never access the shared counter concurrently
+  static constexpr uint32_t kNbrOfIncrements = 1000;
+  static zpp_lib::Mutex s_mutex;
+  static uint32_t s_counter = 0;
+  s_counter                 = 0;
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "contending_thread1", false);
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "contending_thread2", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "contending_thread1");
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "contending_thread2");
+#endif  // CONFIG_USERSPACE
+  auto increment = []() {
+    for (uint32_t i = 0; i < kNbrOfIncrements; i++) {
+      zpp_zassert_true(s_mutex.lock());
+      uint32_t value = s_counter;
+      // give the other thread an opportunity to run while the mutex is locked
+      k_yield();
+      s_counter = value + 1;
+      zpp_zassert_true(s_mutex.unlock());
+    }
+  };
+  zpp_zassert_true(thread1.start(increment));
+  zpp_zassert_true(thread2.start(increment));
+  zpp_zassert_true(thread1.join());
+  zpp_zassert_true(thread2.join());
+  zpp_zassert_equal(s_counter, 2 * kNbrOfIncrements, "Wrong counter value: %u", s_counter);
+}
+
+#if CONFIG_ZPP_MUTEX_STATS
+ZPP_ZTEST(zpp_mutex, test_mutex_stats) {
+  // TESTPOINT: contention on a mutex is reflected in its statistics
+  using std::literals::chrono_literals::operator""ms;
+  static constexpr auto kHoldTime   = 10ms;
+  static constexpr auto kHolderName = "stats_holder";
+  static zpp_lib::Mutex s_stats_mutex("stats_mutex");
+  // the holder thread runs first and sleeps with the mutex locked
+#if CONFIG_USERSPACE
+  zpp_lib::Thread holder(zpp_lib::PreemptableThreadPriority::PriorityHigh, kHolderName, false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread holder(zpp_lib::PreemptableThreadPriority::PriorityHigh, kHolderName);
+#endif  // CONFIG_USERSPACE
+  auto ret = holder.start([]() {
+    zpp_zassert_true(s_stats_mutex.lock());
+    zpp_lib::ThisThread::sleep_for(kHoldTime);
+    zpp_zassert_true(s_stats_mutex.unlock());
+  });
+  zpp_zassert_true(ret);
+  zpp_zassert_true(s_stats_mutex.lock());
+  zpp_zassert_true(s_stats_mutex.unlock());
+  zpp_zassert_true(holder.join());
+
+  auto stats = s_stats_mutex.get_stats();
+  zpp_zassert_true(strcmp(stats.name, "stats_mutex") == 0, "Wrong mutex name");
+  zpp_zassert_equal(stats.nbr_of_acquisitions, 2, "Wrong number of acquisitions: %u", stats.nbr_of_acquisitions);
+  zpp_zassert_equal(stats.nbr_of_contended_acquisitions, 1, "Wrong number of contended acquisitions");
+  zpp_zassert_true(stats.max_wait_time > 0ms && stats.max_wait_time <= kHoldTime + 1ms, "Wrong max wait time");
+  zpp_zassert_true(stats.total_wait_time == stats.max_wait_time, "Wrong total wait time");
+  zpp_zassert_true(stats.max_hold_time >= kHoldTime - 1ms, "Wrong max hold time");
+  zpp_zassert_true(strcmp(stats.worst_wait_owner, kHolderName) == 0, "Wrong owner: %s", stats.worst_wait_owner);
+  zpp_lib::Utils::log_mutex_stats(s_stats_mutex);
+}
+#endif  // CONFIG_ZPP_MUTEX_STATS
+
+ZPP_ZTEST_USER(zpp_mutex, test_benchmark_uncontended) {
+  // compare the cost of an uncontended lock/unlock pair with zpp_lib::Mutex
+  // and with k_mutex (a system call per operation in user mode)
+  zpp_lib::Mutex mutex;
+  zpp_lib::benchmark::measure(kNbrOfIterations, [&mutex]() {
+    zpp_zassert_true(mutex.lock());
+    zpp_zassert_true(mutex.unlock());
+  }).report(kSuiteName, "zpp_mutex_lock_unlock");
+  zpp_lib::benchmark::measure(kNbrOfIterations, []() {
+    zpp_zassert_equal(k_mutex_lock(&s_reference_mutex, K_FOREVER), 0);
+    zpp_zassert_equal(k_mutex_unlock(&s_reference_mutex), 0);
+  }).report(kSuiteName, "k_mutex_lock_unlock");
+}
+
+ZPP_ZTEST_SUITE(zpp_mutex, nullptr, suite_setup, nullptr, nullptr, nullptr);
@@ -0,0 +1,169 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_periodic_thread.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib PeriodicThread class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+#include <atomic>
+#include <chrono>
+
+// zpp_rtos
+#include "zpp_include/periodic_thread.hpp"
+#include "zpp_include/this_thread.hpp"
+#include "zpp_include/time.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_log.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+ZPP_LOG_MODULE_REGISTER(test_periodic_thread, CONFIG_APP_LOG_LEVEL);
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
+
+constexpr auto kPeriod            = 10ms;
+constexpr auto kJobDuration       = 3ms;
+constexpr auto kOverrunDuration   = 15ms;
+constexpr uint32_t kNbrOfReleases = 20;
+// allowed difference between a job start and its release time
+constexpr auto kAllowedJitter = 1ms;
+
+// start times of the jobs
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<std::chrono::microseconds, kNbrOfReleases> s_start_times = {};
+// written by the periodic thread, publishes the start times
+std::atomic<uint32_t> s_nbr_of_jobs = 0;
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+void record_start() {
+  uint32_t index = s_nbr_of_jobs;
+  if (index < kNbrOfReleases) {
+    s_start_times[index] = zpp_lib::Time::get_uptime();
+  }
+  s_nbr_of_jobs = index + 1;
+}
+
+void wait_for_jobs(uint32_t nbr_of_jobs) {
+  while (s_nbr_of_jobs < nbr_of_jobs) {
+    zpp_lib::ThisThread::sleep_for(kPeriod);
+  }
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_periodic_thread, test_no_drift) {
+  // TESTPOINT: jobs are released on absolute times, the execution time of the jobs
+  // does not accumulate
+  s_nbr_of_jobs = 0;
+#if CONFIG_USERSPACE
+  zpp_lib::PeriodicThread thread(zpp_lib::PreemptableThreadPriority::PriorityAboveNormal, "periodic_thread", kPeriod, false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::PeriodicThread thread(zpp_lib::PreemptableThreadPriority::PriorityAboveNormal, "periodic_thread", kPeriod);
+#endif  // CONFIG_USERSPACE
+  zpp_zassert_true(thread.get_period() == kPeriod, "Wrong period");
+  auto first_release = zpp_lib::Time::get_uptime() + kPeriod;
+  auto res           = thread.start(
+      []() {
+        record_start();
+        zpp_lib::ThisThread::busy_wait(kJobDuration);
+      },
+      first_release);
+  zpp_zassert_true(res, "Cannot start periodic thread");
+
+  wait_for_jobs(kNbrOfReleases);
+  zpp_zassert_true(thread.stop(), "Cannot stop periodic thread");
+  // TESTPOINT: a stopped periodic thread cannot be started again
+  res = thread.start([]() {});
+  zpp_zassert_true(!res && res.error() == zpp_lib::ZephyrErrorCode::Already, "Stopped periodic thread restarted");
+
+  for (uint32_t i = 0; i < kNbrOfReleases; i++) {
+    auto release = first_release + i * kPeriod;
+    auto jitter  = s_start_times[i] - release;
+    zpp_zassert_true(jitter >= -kAllowedJitter && jitter <= kAllowedJitter, "Job %d drifted by %lld us", i, jitter.count());
+  }
+
+  auto stats = thread.get_stats();
+  zpp_zassert_true(stats.nbr_of_releases >= kNbrOfReleases, "Wrong number of releases: %u", stats.nbr_of_releases);
+  zpp_zassert_equal(stats.nbr_of_overruns, 0, "Unexpected overruns: %u", stats.nbr_of_overruns);
+  zpp_zassert_true(stats.min_response_time >= kJobDuration - kAllowedJitter, "Response time too short");
+  zpp_zassert_true(stats.max_response_time <= kJobDuration + kAllowedJitter, "Response time too long");
+  zpp_zassert_true(stats.max_release_jitter <= kAllowedJitter, "Release jitter too large");
+  zpp_zassert_true(stats.min_release_jitter <= stats.avg_release_jitter && stats.avg_release_jitter <= stats.max_release_jitter,
+                   "Inconsistent release jitter");
+}
+
+ZPP_ZTEST(zpp_periodic_thread, test_overruns) {
+  // TESTPOINT: overrunning jobs are counted, and the missed releases are skipped
+  // without shifting the following releases
+  static constexpr uint32_t kOverrunPeriod = 4;
+  s_nbr_of_jobs                            = 0;
+#if CONFIG_USERSPACE
+  zpp_lib::PeriodicThread thread(zpp_lib::PreemptableThreadPriority::PriorityAboveNormal, "overrun_thread", kPeriod, false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::PeriodicThread thread(zpp_lib::PreemptableThreadPriority::PriorityAboveNormal, "overrun_thread", kPeriod);
+#endif  // CONFIG_USERSPACE
+  auto first_release = zpp_lib::Time::get_uptime() + kPeriod;
+  auto res           = thread.start(
+      []() {
+        uint32_t index = s_nbr_of_jobs;
+        record_start();
+        zpp_lib::ThisThread::busy_wait(index % kOverrunPeriod == 0 ? kOverrunDuration : kJobDuration);
+      },
+      first_release);
+  zpp_zassert_true(res, "Cannot start periodic thread");
+
+  // the statistics can be read while the thread runs
+  wait_for_jobs(kNbrOfReleases / 2);
+  auto stats = thread.get_stats();
+  zpp_zassert_true(stats.nbr_of_releases > 0 && stats.nbr_of_releases <= kNbrOfReleases / 2, "Wrong number of releases");
+
+  wait_for_jobs(kNbrOfReleases);
+  zpp_zassert_true(thread.stop(), "Cannot stop periodic thread");
+
+  stats = thread.get_stats();
+  zpp_zassert_true(stats.nbr_of_overruns >= kNbrOfReleases / kOverrunPeriod, "Wrong number of overruns: %u", stats.nbr_of_overruns);
+  zpp_zassert_true(stats.max_response_time >= kOverrunDuration, "Overrun not reflected in response time");
+
+  // all jobs start on a release time of the initial grid
+  for (uint32_t i = 0; i < kNbrOfReleases; i++) {
+    auto offset = (s_start_times[i] - first_release) % std::chrono::microseconds(kPeriod);
+    zpp_zassert_true(offset <= kAllowedJitter || offset >= kPeriod - kAllowedJitter,
+                     "Job %d is off the release grid by %lld us",
+                     i,
+                     offset.count());
+  }
+}
+
+ZPP_ZTEST(zpp_periodic_thread, test_invalid_period) {
+  // TESTPOINT: a periodic thread cannot be started with a null period
+#if CONFIG_USERSPACE
+  zpp_lib::PeriodicThread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "invalid_thread", 0us, false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::PeriodicThread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "invalid_thread", 0us);
+#endif  // CONFIG_USERSPACE
+  auto res = thread.start([]() {});
+  zpp_zassert_true(!res && res.error() == zpp_lib::ZephyrErrorCode::Inval, "Null period accepted");
+}
+
+ZPP_ZTEST_SUITE(zpp_periodic_thread, nullptr, nullptr, nullptr, nullptr, nullptr);
@@ -0,0 +1,151 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_priority_message_queue.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib PriorityMessageQueue class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+#include <chrono>
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// zpp_rtos
+#include "zpp_include/message_queue.hpp"
+#include "zpp_include/priority_message_queue.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+// test helpers
+#include "zpp_benchmark.hpp"
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+
+constexpr auto kSuiteName                = "priority_message_queue";
+constexpr uint32_t kQueueSize            = 32;
+constexpr uint8_t kNbrOfLevels           = 3;
+constexpr uint8_t kUrgentPriority        = 0;
+constexpr uint8_t kTelemetryPriority     = kNbrOfLevels - 1;
+constexpr uint32_t kNbrOfIterations      = 20;
+constexpr uint32_t kProcessingTimeInUsec = 10;
+constexpr auto kTimeout                  = 5ms;
+
+struct Message {
+  uint32_t id;
+  uint32_t timestamp;
+};
+
+constexpr uint32_t kUrgentId = 0xFFFFFFFF;
+
+using PriorityQueue = zpp_lib::PriorityMessageQueue<Message, kQueueSize, kNbrOfLevels>;
+
+// processes messages got with get until the urgent message, each telemetry message
+// costing kProcessingTimeInUsec, and returns the latency of the urgent message in cycles
+template <typename GetF> uint32_t wait_for_urgent(GetF get) {
+  Message message = {};
+  while (true) {
+    zpp_zassert_true(get(message), "No message received");
+    if (message.id == kUrgentId) {
+      return zpp_lib::benchmark::cycles_now() - message.timestamp;
+    }
+    k_busy_wait(kProcessingTimeInUsec);
+  }
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_priority_message_queue, test_priority_order) {
+  PriorityQueue queue;
+
+  // TESTPOINT: messages are got by priority, in FIFO order within a level, and messages
+  // put at the front of a level come first in this level
+  zpp_zassert_true(queue.try_put_for(0ms, {1, 0}, kTelemetryPriority), "Cannot put message");
+  zpp_zassert_true(queue.try_put_for(0ms, {2, 0}, kTelemetryPriority), "Cannot put message");
+  zpp_zassert_true(queue.try_put_for(0ms, {3, 0}, 1), "Cannot put message");
+  zpp_zassert_true(queue.try_put_front_for(0ms, {4, 0}, kTelemetryPriority), "Cannot put message");
+  zpp_zassert_true(queue.try_put_for(0ms, {5, 0}, kUrgentPriority), "Cannot put message");
+  zpp_zassert_equal(queue.get_nbr_of_queued_messages(), 5, "Wrong number of queued messages");
+  zpp_zassert_equal(queue.get_nbr_of_queued_messages(kTelemetryPriority), 3, "Wrong number of queued messages");
+
+  constexpr std::array<uint32_t, 5> kExpectedIds       = {5, 3, 4, 1, 2};
+  constexpr std::array<uint8_t, 5> kExpectedPriorities = {0, 1, 2, 2, 2};
+  for (uint32_t i = 0; i < kExpectedIds.size(); i++) {
+    Message message  = {};
+    uint8_t priority = 0;
+    zpp_zassert_true(queue.try_get_for(0ms, message, priority), "Cannot get message");
+    zpp_zassert_equal(message.id, kExpectedIds[i], "Wrong message order");
+    zpp_zassert_equal(priority, kExpectedPriorities[i], "Wrong message priority");
+  }
+
+  // TESTPOINT: getting from an empty queue expires
+  Message message = {};
+  auto res        = queue.try_get_for(kTimeout, message);
+  zpp_zassert_true(!res.has_error() && !res, "Message got from an empty queue");
+}
+
+ZPP_ZTEST(zpp_priority_message_queue, test_full_level) {
+  PriorityQueue queue;
+
+  // TESTPOINT: a full level does not prevent putting messages in other levels
+  for (uint32_t i = 0; i < kQueueSize; i++) {
+    zpp_zassert_true(queue.try_put_for(0ms, {i, 0}, kTelemetryPriority), "Cannot put message");
+  }
+  auto res = queue.try_put_for(kTimeout, {kQueueSize, 0}, kTelemetryPriority);
+  zpp_zassert_true(!res.has_error() && !res, "Message put in a full level");
+  zpp_zassert_true(queue.try_put_front_for(0ms, {kUrgentId, 0}), "Cannot put urgent message");
+  Message message = {};
+  zpp_zassert_true(queue.try_get_for(0ms, message) && message.id == kUrgentId, "Urgent message not got first");
+}
+
+ZPP_ZTEST(zpp_priority_message_queue, test_benchmark_urgent_latency) {
+  // compare the latency of an urgent message put behind a full backlog of telemetry
+  // messages in a message queue with the latency in a priority message queue
+  static zpp_lib::MessageQueue<Message, kQueueSize> fifo_queue;
+  static PriorityQueue priority_queue;
+  zpp_lib::benchmark::CycleStats fifo_stats;
+  zpp_lib::benchmark::CycleStats priority_stats;
+  for (uint32_t iteration = 0; iteration < kNbrOfIterations; iteration++) {
+    for (uint32_t i = 0; i < kQueueSize - 1; i++) {
+      zpp_zassert_true(fifo_queue.try_put_for(0ms, {i, 0}), "Cannot put telemetry message");
+    }
+    zpp_zassert_true(fifo_queue.try_put_for(0ms, {kUrgentId, zpp_lib::benchmark::cycles_now()}), "Cannot put urgent message");
+    fifo_stats.add(wait_for_urgent([](Message& message) { return fifo_queue.try_get_for(kTimeout, message); }));
+
+    for (uint32_t i = 0; i < kQueueSize; i++) {
+      zpp_zassert_true(priority_queue.try_put_for(0ms, {i, 0}, kTelemetryPriority), "Cannot put telemetry message");
+    }
+    zpp_zassert_true(priority_queue.try_put_for(0ms, {kUrgentId, zpp_lib::benchmark::cycles_now()}, kUrgentPriority),
+                     "Cannot put urgent message");
+    priority_stats.add(wait_for_urgent([](Message& message) { return priority_queue.try_get_for(kTimeout, message); }));
+    Message message = {};
+    while (priority_queue.try_get_for(0ms, message)) {
+      // drop the telemetry backlog
+    }
+  }
+  fifo_stats.report(kSuiteName, "fifo_urgent_latency");
+  priority_stats.report(kSuiteName, "priority_urgent_latency");
+  zpp_zassert_true(priority_stats.max() < fifo_stats.max(), "Urgent messages not served first");
+}
+
+ZPP_ZTEST_SUITE(zpp_priority_message_queue, nullptr, nullptr, nullptr, nullptr, nullptr);
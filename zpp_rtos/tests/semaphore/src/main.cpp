@@ -23,14 +23,75 @@
  ***************************************************************************/
 
 // stl
+#include <array>
+#include <chrono>
 #include <memory>
 
+// zephyr
+#include <zephyr/kernel.h>
+
 // zpp_rtos
 #include "zpp_include/semaphore.hpp"
+#include "zpp_include/this_thread.hpp"
 #include "zpp_include/thread.hpp"
 #include "zpp_include/zpp_assert.hpp"
 #include "zpp_include/zpp_test.hpp"
 
+// test helpers
+#include "zpp_benchmark.hpp"
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+
+constexpr auto kSuiteName       = "semaphore";
+constexpr uint8_t kNbrOfWaiters = 3;
+constexpr uint32_t kNbrOfRounds = 10;
+constexpr auto kTimeout         = 5ms;
+
+// cycle count at which each waiter was woken up
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<uint32_t, kNbrOfWaiters> s_wake_up_cycles = {};
+
+// starts kNbrOfWaiters threads waiting on a semaphore, wakes them up with release_all and
+// returns the number of cycles elapsed until the last waiter ran
+template <typename ReleaseF>
+uint32_t measure_wake_up(ReleaseF release_all) {
+  zpp_lib::Semaphore sem(0, kNbrOfWaiters);
+  // the waiters have a higher priority than the releasing thread and block as soon as
+  // they are started
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread0(zpp_lib::PreemptableThreadPriority::PriorityHigh, "waiter0", false);
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityHigh, "waiter1", false);
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityHigh, "waiter2", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread0(zpp_lib::PreemptableThreadPriority::PriorityHigh, "waiter0");
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityHigh, "waiter1");
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityHigh, "waiter2");
+#endif  // CONFIG_USERSPACE
+  std::array<zpp_lib::Thread*, kNbrOfWaiters> threads = {&thread0, &thread1, &thread2};
+  for (uint8_t i = 0; i < kNbrOfWaiters; i++) {
+    auto res = threads[i]->start([&sem, i]() {
+      zpp_zassert_true(sem.acquire());
+      s_wake_up_cycles[i] = zpp_lib::benchmark::cycles_now();
+    });
+    zpp_zassert_true(res, "Cannot start waiter");
+  }
+
+  uint32_t start_cycles = zpp_lib::benchmark::cycles_now();
+  release_all(sem);
+  for (auto* p_thread : threads) {
+    zpp_zassert_true(p_thread->join(), "Cannot join waiter");
+  }
+  uint32_t elapsed_cycles = 0;
+  for (auto wake_up_cycles : s_wake_up_cycles) {
+    elapsed_cycles = wake_up_cycles - start_cycles > elapsed_cycles ? wake_up_cycles - start_cycles : elapsed_cycles;
+  }
+  return elapsed_cycles;
+}
+
+}  // namespace
+
 // test cases
 ZPP_ZTEST_USER(zpp_semaphore, test_semaphore_release_acquire) {
   static constexpr uint32_t kInitialCount = 0U;
@@ -65,4 +126,65 @@ ZPP_ZTEST_USER(zpp_semaphore, test_semaphore_release_acquire) {
   zpp_zassert_true(sem.acquire());
 }
 
+ZPP_ZTEST_USER(zpp_semaphore, test_semaphore_timed_acquire) {
+  zpp_lib::Semaphore sem(0, 1);
+
+  // TESTPOINT: timed acquisitions of an unavailable resource expire without error
+  auto bool_ret = sem.try_acquire_for(kTimeout);
+  zpp_zassert_true(!bool_ret.has_error() && !bool_ret, "Unavailable resource acquired");
+  std::chrono::milliseconds now(k_uptime_get());
+  bool_ret = sem.try_acquire_until(now + kTimeout);
+  zpp_zassert_true(!bool_ret.has_error() && !bool_ret, "Unavailable resource acquired");
+
+  // TESTPOINT: timed acquisitions of an available resource succeed
+  zpp_zassert_true(sem.release());
+  bool_ret = sem.try_acquire_for(kTimeout);
+  zpp_zassert_true(!bool_ret.has_error() && bool_ret, "Available resource not acquired");
+  zpp_zassert_true(sem.release());
+  now      = std::chrono::milliseconds(k_uptime_get());
+  bool_ret = sem.try_acquire_until(now + kTimeout);
+  zpp_zassert_true(!bool_ret.has_error() && bool_ret, "Available resource not acquired");
+}
+
+ZPP_ZTEST_USER(zpp_semaphore, test_semaphore_batch) {
+  static constexpr uint32_t kMaxCount = 5U;
+  zpp_lib::Semaphore sem(0, kMaxCount);
+
+  // TESTPOINT: resources released at once can be acquired at once
+  zpp_zassert_true(sem.release(3));
+  auto bool_ret = sem.acquire_n(3, kTimeout);
+  zpp_zassert_true(!bool_ret.has_error() && bool_ret, "Released resources not acquired");
+  bool_ret = sem.try_acquire();
+  zpp_zassert_true(!bool_ret.has_error() && !bool_ret, "Too many resources released");
+
+  // TESTPOINT: the count saturates at the maximum count
+  zpp_zassert_true(sem.release(2 * kMaxCount));
+  bool_ret = sem.acquire_n(kMaxCount + 1, kTimeout);
+  zpp_zassert_true(!bool_ret.has_error() && !bool_ret, "More resources acquired than the maximum count");
+
+  // TESTPOINT: a failed batch acquisition gives back the acquired resources
+  bool_ret = sem.acquire_n(kMaxCount, kTimeout);
+  zpp_zassert_true(!bool_ret.has_error() && bool_ret, "Resources not given back");
+}
+
+ZPP_ZTEST(zpp_semaphore, test_benchmark_wake_up) {
+  // compare the cost of waking up kNbrOfWaiters threads with one release() per waiter
+  // and with a single release(kNbrOfWaiters)
+  auto priority = zpp_lib::ThisThread::get_priority();
+  zpp_lib::ThisThread::set_priority(zpp_lib::PreemptableThreadPriority::PriorityNormal);
+  zpp_lib::benchmark::CycleStats loop_stats;
+  zpp_lib::benchmark::CycleStats batch_stats;
+  for (uint32_t round = 0; round < kNbrOfRounds; round++) {
+    loop_stats.add(measure_wake_up([](zpp_lib::Semaphore& sem) {
+      for (uint8_t i = 0; i < kNbrOfWaiters; i++) {
+        zpp_zassert_true(sem.release());
+      }
+    }));
+    batch_stats.add(measure_wake_up([](zpp_lib::Semaphore& sem) { zpp_zassert_true(sem.release(kNbrOfWaiters)); }));
+  }
+  loop_stats.report(kSuiteName, "wake_up_release_loop");
+  batch_stats.report(kSuiteName, "wake_up_release_batch");
+  zpp_lib::ThisThread::set_priority(priority);
+}
+
 ZPP_ZTEST_SUITE(zpp_semaphore, nullptr, nullptr, nullptr, nullptr, nullptr);
@@ -0,0 +1,244 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_shared_mutex.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib SharedMutex class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// zpp_rtos
+#include "zpp_include/mutex.hpp"
+#include "zpp_include/shared_mutex.hpp"
+#include "zpp_include/this_thread.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_log.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+// test helpers
+#include "zpp_benchmark.hpp"
+
+ZPP_LOG_MODULE_REGISTER(test_shared_mutex, CONFIG_APP_LOG_LEVEL);
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+
+constexpr auto kSuiteName       = "shared_mutex";
+constexpr uint8_t kNbrOfReaders = 3;
+constexpr uint32_t kNbrOfReads  = 200;
+// one read out of kWritePeriod is replaced by a write
+constexpr uint32_t kWritePeriod = 20;
+constexpr auto kTimeout         = 5ms;
+
+// table protected by the mutexes in the benchmark
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<uint32_t, 16> s_table = {};
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+uint32_t read_table() {
+  uint32_t sum = 0;
+  for (const auto& value : s_table) {
+    sum += value;
+    // let other readers run in the middle of the read
+    k_yield();
+  }
+  return sum;
+}
+
+void write_table() {
+  for (auto& value : s_table) {
+    value++;
+  }
+}
+
+// runs kNbrOfReaders threads doing kNbrOfReads accesses to the table each, and reports
+// the average number of cycles per access
+template <typename ReadF, typename WriteF>
+void benchmark_reads(const char* name, ReadF read, WriteF write) {
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread0(zpp_lib::PreemptableThreadPriority::PriorityNormal, "reader0", false);
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "reader1", false);
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "reader2", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread0(zpp_lib::PreemptableThreadPriority::PriorityNormal, "reader0");
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "reader1");
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "reader2");
+#endif  // CONFIG_USERSPACE
+  std::array<zpp_lib::Thread*, kNbrOfReaders> threads = {&thread0, &thread1, &thread2};
+  auto accesses                                       = [&read, &write]() {
+    for (uint32_t i = 0; i < kNbrOfReads; i++) {
+      if (i % kWritePeriod == 0) {
+        write();
+      } else {
+        read();
+      }
+    }
+  };
+
+  uint32_t start_cycles = zpp_lib::benchmark::cycles_now();
+  for (auto* p_thread : threads) {
+    zpp_zassert_true(p_thread->start(accesses), "Cannot start reader");
+  }
+  for (auto* p_thread : threads) {
+    zpp_zassert_true(p_thread->join(), "Cannot join reader");
+  }
+  uint32_t elapsed_cycles = zpp_lib::benchmark::cycles_now() - start_cycles;
+  zpp_lib::benchmark::report_value(kSuiteName, name, "cycles", elapsed_cycles / (kNbrOfReaders * kNbrOfReads));
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_shared_mutex, test_shared_ownership) {
+  // TESTPOINT: several threads own the mutex in shared mode, exclusive ownership is refused
+  zpp_lib::SharedMutex mutex;
+  zpp_zassert_true(mutex.lock_shared());
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "shared_thread", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "shared_thread");
+#endif  // CONFIG_USERSPACE
+  auto res = thread.start([&mutex]() {
+    auto acquired = mutex.try_lock_shared();
+    zpp_zassert_true(!acquired.has_error() && acquired, "Shared ownership refused");
+    acquired = mutex.try_lock_for(kTimeout);
+    zpp_zassert_true(!acquired.has_error() && !acquired, "Exclusive ownership granted to a reader");
+    zpp_zassert_true(mutex.unlock_shared());
+  });
+  zpp_zassert_true(res);
+  zpp_zassert_true(thread.join());
+  zpp_zassert_true(mutex.unlock_shared());
+
+  // TESTPOINT: the mutex can be owned exclusively once all readers released it
+  auto acquired = mutex.try_lock();
+  zpp_zassert_true(!acquired.has_error() && acquired, "Exclusive ownership refused");
+  zpp_zassert_true(mutex.unlock());
+}
+
+ZPP_ZTEST(zpp_shared_mutex, test_exclusive_ownership) {
+  // TESTPOINT: readers cannot own the mutex while a writer owns it
+  zpp_lib::SharedMutex mutex;
+  zpp_zassert_true(mutex.lock());
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "exclusive_thread", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "exclusive_thread");
+#endif  // CONFIG_USERSPACE
+  auto res = thread.start([&mutex]() {
+    auto acquired = mutex.try_lock_shared_for(kTimeout);
+    zpp_zassert_true(!acquired.has_error() && !acquired, "Shared ownership granted during a write");
+  });
+  zpp_zassert_true(res);
+  zpp_zassert_true(thread.join());
+  zpp_zassert_true(mutex.unlock());
+
+  // TESTPOINT: releasing a mutex that is not owned is an error
+  zpp_zassert_true(!mutex.unlock(), "Unowned mutex released");
+  zpp_zassert_true(!mutex.unlock_shared(), "Unowned mutex released");
+}
+
+ZPP_ZTEST(zpp_shared_mutex, test_writer_preference) {
+  // TESTPOINT: new readers wait while a writer waits for the mutex
+  static zpp_lib::SharedMutex s_mutex;
+  // written by the writer thread
+  static std::atomic<bool> s_has_written = false;
+  s_has_written = false;
+  auto priority = zpp_lib::ThisThread::get_priority();
+  zpp_lib::ThisThread::set_priority(zpp_lib::PreemptableThreadPriority::PriorityNormal);
+  zpp_zassert_true(s_mutex.lock_shared());
+  // the writer has a higher priority and runs as soon as it is started
+#if CONFIG_USERSPACE
+  zpp_lib::Thread writer(zpp_lib::PreemptableThreadPriority::PriorityHigh, "writer_thread", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread writer(zpp_lib::PreemptableThreadPriority::PriorityHigh, "writer_thread");
+#endif  // CONFIG_USERSPACE
+  auto res = writer.start([]() {
+    zpp_zassert_true(s_mutex.lock());
+    s_has_written = true;
+    zpp_zassert_true(s_mutex.unlock());
+  });
+  zpp_zassert_true(res);
+
+  auto acquired = s_mutex.try_lock_shared();
+  zpp_zassert_true(!acquired.has_error() && !acquired, "Reader overtook a waiting writer");
+  zpp_zassert_true(!s_has_written, "Writer did not wait for the reader");
+  zpp_zassert_true(s_mutex.unlock_shared());
+  zpp_zassert_true(writer.join());
+  zpp_zassert_true(s_has_written, "Writer did not get the mutex");
+  zpp_lib::ThisThread::set_priority(priority);
+}
+
+ZPP_ZTEST(zpp_shared_mutex, test_std_locks) {
+  // TESTPOINT: the mutex can be used with std::shared_lock and std::unique_lock
+  zpp_lib::SharedMutex mutex;
+  {
+    std::shared_lock<zpp_lib::SharedMutex> reader1(mutex);
+    std::shared_lock<zpp_lib::SharedMutex> reader2(mutex, std::try_to_lock);
+    zpp_zassert_true(reader1.owns_lock() && reader2.owns_lock(), "Shared locks not owned");
+    std::unique_lock<zpp_lib::SharedMutex> writer(mutex, std::try_to_lock);
+    zpp_zassert_true(!writer.owns_lock(), "Unique lock owned with shared locks");
+  }
+  std::unique_lock<zpp_lib::SharedMutex> writer(mutex, kTimeout);
+  zpp_zassert_true(writer.owns_lock(), "Unique lock not owned");
+  std::shared_lock<zpp_lib::SharedMutex> reader(mutex, kTimeout);
+  zpp_zassert_true(!reader.owns_lock(), "Shared lock owned with a unique lock");
+}
+
+ZPP_ZTEST(zpp_shared_mutex, test_benchmark_read_heavy) {
+  // compare the throughput of readers sharing a table protected by a Mutex
+  // and by a SharedMutex
+  auto priority = zpp_lib::ThisThread::get_priority();
+  zpp_lib::ThisThread::set_priority(zpp_lib::PreemptableThreadPriority::PriorityHigh);
+  zpp_lib::Mutex mutex;
+  benchmark_reads(
+      "mutex_access",
+      [&mutex]() {
+        std::scoped_lock<zpp_lib::Mutex> guard(mutex);
+        read_table();
+      },
+      [&mutex]() {
+        std::scoped_lock<zpp_lib::Mutex> guard(mutex);
+        write_table();
+      });
+
+  zpp_lib::SharedMutex shared_mutex;
+  benchmark_reads(
+      "shared_mutex_access",
+      [&shared_mutex]() {
+        std::shared_lock<zpp_lib::SharedMutex> guard(shared_mutex);
+        read_table();
+      },
+      [&shared_mutex]() {
+        std::unique_lock<zpp_lib::SharedMutex> guard(shared_mutex);
+        write_table();
+      });
+  zpp_lib::ThisThread::set_priority(priority);
+}
+
+ZPP_ZTEST_SUITE(zpp_shared_mutex, nullptr, nullptr, nullptr, nullptr, nullptr);
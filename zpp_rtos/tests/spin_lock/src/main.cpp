@@ -0,0 +1,140 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_spin_lock.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib SpinLock class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <mutex>
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// zpp_rtos
+#include "zpp_include/mutex.hpp"
+#include "zpp_include/spin_lock.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+// test helpers
+#include "zpp_benchmark.hpp"
+
+namespace {
+
+constexpr auto kSuiteName           = "spin_lock";
+constexpr uint32_t kNbrOfIterations = 1000;
+constexpr uint32_t kNbrOfTimerTicks = 20;
+
+// state shared between the timer ISR and the test thread
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+zpp_lib::SpinLock s_lock;
+uint32_t s_isr_count    = 0;
+uint32_t s_thread_count = 0;
+uint32_t s_total_count  = 0;
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+// returns whether interrupts are enabled on the current CPU
+bool irqs_enabled() {
+  unsigned int key = irq_lock();
+  bool enabled     = arch_irq_unlocked(key);
+  irq_unlock(key);
+  return enabled;
+}
+
+void timer_expiry(struct k_timer* /*timer*/) {
+  zpp_lib::SpinLockGuard guard(s_lock);
+  s_isr_count++;
+  s_total_count++;
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_spin_lock, test_lock_unlock) {
+  // TESTPOINT: interrupts are disabled while the lock is owned and the interrupt state
+  // is restored when it is released, with the key stored in the lock or in the guard
+  zpp_lib::SpinLock lock;
+  zpp_zassert_true(irqs_enabled(), "Interrupts disabled before locking");
+  {
+    std::scoped_lock<zpp_lib::SpinLock> guard(lock);
+    zpp_zassert_true(!irqs_enabled(), "Interrupts enabled with the lock owned");
+  }
+  zpp_zassert_true(irqs_enabled(), "Interrupts not restored by unlock()");
+  {
+    zpp_lib::SpinLockGuard guard(lock);
+    zpp_zassert_true(!irqs_enabled(), "Interrupts enabled with the lock owned");
+  }
+  zpp_zassert_true(irqs_enabled(), "Interrupts not restored by the guard");
+#if CONFIG_SMP
+  // TESTPOINT: a released lock can be acquired with try_lock()
+  zpp_zassert_true(lock.try_lock(), "Spin lock not released");
+  zpp_zassert_true(!irqs_enabled(), "Interrupts enabled with the lock owned");
+  lock.unlock();
+  zpp_zassert_true(irqs_enabled(), "Interrupts not restored by unlock()");
+#endif  // CONFIG_SMP
+}
+
+ZPP_ZTEST(zpp_spin_lock, test_shared_with_isr) {
+  // TESTPOINT: state shared with an ISR is consistent when protected by the spin lock
+  s_isr_count    = 0;
+  s_thread_count = 0;
+  s_total_count  = 0;
+  struct k_timer timer;
+  k_timer_init(&timer, timer_expiry, nullptr);
+  k_timer_start(&timer, K_MSEC(1), K_MSEC(1));
+  uint32_t isr_count = 0;
+  while (isr_count < kNbrOfTimerTicks) {
+    zpp_lib::SpinLockGuard guard(s_lock);
+    s_thread_count++;
+    s_total_count++;
+    isr_count = s_isr_count;
+  }
+  k_timer_stop(&timer);
+
+  uint32_t total_count = 0;
+  {
+    zpp_lib::SpinLockGuard guard(s_lock);
+    total_count = s_isr_count + s_thread_count;
+  }
+  zpp_zassert_equal(s_total_count, total_count, "Inconsistent counters");
+}
+
+ZPP_ZTEST(zpp_spin_lock, test_benchmark_short_section) {
+  // compare the cost of a critical section shorter than 1 us protected by a
+  // spin lock and by a mutex
+  static uint32_t s_counter = 0;
+  zpp_lib::SpinLock lock;
+  zpp_lib::benchmark::measure(kNbrOfIterations, [&lock]() {
+    zpp_lib::SpinLockGuard guard(lock);
+    s_counter++;
+  }).report(kSuiteName, "spin_lock_section");
+  zpp_lib::benchmark::measure(kNbrOfIterations, [&lock]() {
+    std::scoped_lock<zpp_lib::SpinLock> guard(lock);
+    s_counter++;
+  }).report(kSuiteName, "spin_lock_scoped_lock_section");
+  zpp_lib::Mutex mutex;
+  zpp_lib::benchmark::measure(kNbrOfIterations, [&mutex]() {
+    std::scoped_lock<zpp_lib::Mutex> guard(mutex);
+    s_counter++;
+  }).report(kSuiteName, "mutex_section");
+  zpp_zassert_equal(s_counter, 3 * kNbrOfIterations, "Wrong counter value");
+}
+
+ZPP_ZTEST_SUITE(zpp_spin_lock, nullptr, nullptr, nullptr, nullptr, nullptr);
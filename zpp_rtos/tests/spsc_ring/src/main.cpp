@@ -0,0 +1,164 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_spsc_ring.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib SpscRing class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+#include <chrono>
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// zpp_rtos
+#include "zpp_include/message_queue.hpp"
+#include "zpp_include/spsc_ring.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+// test helpers
+#include "zpp_benchmark.hpp"
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""s;
+
+constexpr auto kSuiteName               = "spsc_ring";
+constexpr size_t kRingSize              = 16;
+constexpr uint32_t kNbrOfTicks          = 20;
+constexpr uint32_t kNbrOfItemsPerTick   = 4;
+constexpr uint32_t kNbrOfBenchmarkItems = 2000;
+constexpr size_t kBatchSize             = 8;
+constexpr auto kTimeout                 = 100ms;
+
+using Ring = zpp_lib::SpscRing<uint32_t, kRingSize>;
+
+// ring filled by the timer ISR
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+Ring* s_p_isr_ring             = nullptr;
+uint32_t s_nbr_of_isr_items    = 0;
+uint32_t s_nbr_of_pushed_items = 0;
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+void timer_expiry(struct k_timer* timer) {
+  std::array<uint32_t, kNbrOfItemsPerTick> items = {};
+  for (auto& item : items) {
+    item = s_nbr_of_isr_items++;
+  }
+  s_nbr_of_pushed_items += s_p_isr_ring->push_n(items.data(), items.size());
+  if (s_nbr_of_isr_items == kNbrOfTicks * kNbrOfItemsPerTick) {
+    k_timer_stop(timer);
+  }
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_spsc_ring, test_push_pop) {
+  Ring ring;
+
+  // TESTPOINT: the ring holds capacity() items, in FIFO order
+  for (uint32_t i = 0; i < Ring::capacity(); i++) {
+    zpp_zassert_true(ring.try_push(i), "Cannot push item %d", i);
+  }
+  zpp_zassert_true(!ring.try_push(0), "Item pushed in a full ring");
+  zpp_zassert_equal(ring.size(), Ring::capacity(), "Wrong ring size");
+  uint32_t item = 0;
+  for (uint32_t i = 0; i < Ring::capacity(); i++) {
+    zpp_zassert_true(ring.try_pop(item) && item == i, "Wrong item popped");
+  }
+  zpp_zassert_true(!ring.try_pop(item) && ring.empty(), "Item popped from an empty ring");
+
+  // TESTPOINT: bulk operations transfer as many items as possible, also across the end
+  // of the buffer
+  std::array<uint32_t, kRingSize + kBatchSize> items = {};
+  for (uint32_t i = 0; i < items.size(); i++) {
+    items[i] = i;
+  }
+  zpp_zassert_equal(ring.push_n(items.data(), kBatchSize), kBatchSize, "Wrong number of pushed items");
+  zpp_zassert_equal(ring.push_n(&items[kBatchSize], items.size() - kBatchSize), kRingSize - kBatchSize, "Wrong number of pushed items");
+  std::array<uint32_t, kRingSize + kBatchSize> popped_items = {};
+  zpp_zassert_equal(ring.pop_n(popped_items.data(), popped_items.size()), kRingSize, "Wrong number of popped items");
+  for (uint32_t i = 0; i < kRingSize; i++) {
+    zpp_zassert_equal(popped_items[i], i, "Wrong item popped");
+  }
+
+  // TESTPOINT: waiting on an empty ring expires
+  auto res = ring.try_pop_for(5ms, item);
+  zpp_zassert_true(!res.has_error() && !res, "Item popped from an empty ring");
+}
+
+ZPP_ZTEST(zpp_spsc_ring, test_isr_to_thread) {
+  // TESTPOINT: all items pushed by an ISR are received in order by a waiting thread
+  Ring ring;
+  s_p_isr_ring          = &ring;
+  s_nbr_of_isr_items    = 0;
+  s_nbr_of_pushed_items = 0;
+  struct k_timer timer;
+  k_timer_init(&timer, timer_expiry, nullptr);
+  k_timer_start(&timer, K_MSEC(1), K_MSEC(1));
+  uint32_t nbr_of_received              = 0;
+  std::array<uint32_t, kRingSize> items = {};
+  while (nbr_of_received < kNbrOfTicks * kNbrOfItemsPerTick) {
+    size_t nbr_of_popped = ring.try_pop_n_for(kTimeout, items.data(), items.size());
+    zpp_zassert_true(nbr_of_popped > 0, "No item received");
+    for (size_t i = 0; i < nbr_of_popped; i++) {
+      zpp_zassert_equal(items[i], nbr_of_received, "Wrong item received");
+      nbr_of_received++;
+    }
+  }
+  k_timer_stop(&timer);
+  zpp_zassert_equal(s_nbr_of_pushed_items, kNbrOfTicks * kNbrOfItemsPerTick, "Items lost by the ISR");
+  s_p_isr_ring = nullptr;
+}
+
+ZPP_ZTEST(zpp_spsc_ring, test_benchmark_throughput) {
+  // compare the cost of transferring items between two threads with a ring and with a
+  // message queue of the same size
+  Ring ring;
+  auto ring_cycles = zpp_lib::benchmark::measure_transfer(
+      kNbrOfBenchmarkItems,
+      [&ring](uint32_t item) {
+        while (!ring.try_push(item)) {
+          k_yield();
+        }
+      },
+      [&ring]() {
+        uint32_t item = 0;
+        zpp_zassert_true(ring.try_pop_for(kTimeout, item), "No item received");
+        return item;
+      });
+  zpp_lib::benchmark::report_value(kSuiteName, "ring_transfer", "cycles", ring_cycles);
+
+  zpp_lib::MessageQueue<uint32_t, kRingSize> queue;
+  auto queue_cycles = zpp_lib::benchmark::measure_transfer(
+      kNbrOfBenchmarkItems,
+      [&queue](uint32_t item) { zpp_zassert_true(queue.try_put_for(1s, item)); },
+      [&queue]() {
+        uint32_t item = 0;
+        zpp_zassert_true(queue.try_get_for(kTimeout, item), "No item received");
+        return item;
+      });
+  zpp_lib::benchmark::report_value(kSuiteName, "message_queue_transfer", "cycles", queue_cycles);
+}
+
+ZPP_ZTEST_SUITE(zpp_spsc_ring, nullptr, nullptr, nullptr, nullptr, nullptr);
@@ -25,6 +25,7 @@
 // zephyr
 
 // std
+#include <atomic>
 #include <functional>
 
 // zpp_rtos
@@ -212,4 +213,147 @@ ZPP_ZTEST_USER(zpp_thread, test_round_robin) {
                    s_counter2);
 }
 
+ZPP_ZTEST_USER(zpp_thread, test_stack_size_classes) {
+  // TESTPOINT: threads created with a stack size get a stack from a matching size class
+  static constexpr auto kSmallThreadName = "small_stack_thread";
+  static constexpr auto kLargeThreadName = "large_stack_thread";
+  static constexpr size_t kSmallStackSize = 512;
+  static constexpr size_t kLargeStackSize = 2048;
+  // size of the stack class following the 2048 bytes class
+  static constexpr size_t kLargerClassStackSize = 4096;
+#if CONFIG_USERSPACE
+  zpp_lib::Thread small_thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, kSmallThreadName, true, kSmallStackSize);
+  zpp_lib::Thread large_thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, kLargeThreadName, true, kLargeStackSize);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread small_thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, kSmallThreadName, kSmallStackSize);
+  zpp_lib::Thread large_thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, kLargeThreadName, kLargeStackSize);
+#endif  // CONFIG_USERSPACE
+
+  // written by the started threads, which run in user mode with CONFIG_USERSPACE
+  static ZTEST_BMEM std::atomic<size_t> s_small_stack_size = 0;
+  static ZTEST_BMEM std::atomic<size_t> s_large_stack_size = 0;
+  auto res = small_thread.start([]() {
+#if CONFIG_THREAD_STACK_INFO
+    s_small_stack_size = k_current_get()->stack_info.size;
+#else   // CONFIG_THREAD_STACK_INFO
+    s_small_stack_size = kSmallStackSize;
+#endif  // CONFIG_THREAD_STACK_INFO
+  });
+  zpp_zassert_true(res, "Cannot start small stack thread");
+  res = large_thread.start([]() {
+#if CONFIG_THREAD_STACK_INFO
+    s_large_stack_size = k_current_get()->stack_info.size;
+#else   // CONFIG_THREAD_STACK_INFO
+    s_large_stack_size = kLargeStackSize;
+#endif  // CONFIG_THREAD_STACK_INFO
+  });
+  zpp_zassert_true(res, "Cannot start large stack thread");
+
+  zpp_zassert_true(small_thread.join(), "Cannot join small stack thread");
+  zpp_zassert_true(large_thread.join(), "Cannot join large stack thread");
+  zpp_zassert_true(s_small_stack_size >= kSmallStackSize, "Small stack is too small: %zu", s_small_stack_size.load());
+  zpp_zassert_true(s_large_stack_size >= kLargeStackSize, "Large stack is too small: %zu", s_large_stack_size.load());
+  // TESTPOINT: the smallest class that fits is used, not the default stacks or a larger class
+  zpp_zassert_true(s_small_stack_size < CONFIG_ZPP_THREAD_STACK_SIZE, "Small stack from a larger class: %zu", s_small_stack_size.load());
+  zpp_zassert_true(s_large_stack_size < kLargerClassStackSize, "Large stack from a larger class: %zu", s_large_stack_size.load());
+}
+
+ZPP_ZTEST_USER(zpp_thread, test_slot_reuse) {
+  // TESTPOINT: threads that terminate out of order release their stack, which
+  // can then be reused while other threads are still running
+  static constexpr auto kLongThreadName  = "long_thread";
+  static constexpr auto kShortThreadName = "short_thread";
+  // more rounds than pre-allocated stacks, for making sure that stacks are reclaimed
+  static constexpr uint8_t kNbrOfRounds = 2 * (CONFIG_ZPP_THREAD_POOL_SIZE + 1);
+  static constexpr std::chrono::milliseconds kPollPeriod(1);
+
+  // shared between the test thread and the started threads, which run in user mode with
+  // CONFIG_USERSPACE
+  static ZTEST_BMEM std::atomic<bool> s_stop         = false;
+  static ZTEST_BMEM std::atomic<uint32_t> s_nbr_runs = 0;
+  for (uint8_t round = 0; round < kNbrOfRounds; round++) {
+#if CONFIG_USERSPACE
+    zpp_lib::Thread long_thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, kLongThreadName, true);
+#else   // CONFIG_USERSPACE
+    zpp_lib::Thread long_thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, kLongThreadName);
+#endif  // CONFIG_USERSPACE
+    s_stop   = false;
+    auto res = long_thread.start([]() {
+      while (!s_stop) {
+        zpp_lib::ThisThread::sleep_for(kPollPeriod);
+      }
+    });
+    zpp_zassert_true(res, "Cannot start long thread: %d", static_cast<int>(res.error()));
+
+    // the short threads terminate before the long thread and reuse the same stack
+    s_nbr_runs = 0;
+    for (uint8_t index = 0; index < CONFIG_ZPP_THREAD_POOL_SIZE + 1; index++) {
+#if CONFIG_USERSPACE
+      zpp_lib::Thread short_thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, kShortThreadName, true);
+#else   // CONFIG_USERSPACE
+      zpp_lib::Thread short_thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, kShortThreadName);
+#endif  // CONFIG_USERSPACE
+      res = short_thread.start([]() { s_nbr_runs++; });
+      zpp_zassert_true(res, "Cannot start short thread %d in round %d: %d", index, round, static_cast<int>(res.error()));
+      res = short_thread.join();
+      zpp_zassert_true(res, "Cannot join short thread: %d", static_cast<int>(res.error()));
+    }
+    zpp_zassert_true(s_nbr_runs == CONFIG_ZPP_THREAD_POOL_SIZE + 1, "Short threads did not all run: %d", s_nbr_runs.load());
+
+    s_stop = true;
+    res    = long_thread.join();
+    zpp_zassert_true(res, "Cannot join long thread: %d", static_cast<int>(res.error()));
+  }
+}
+
+#if CONFIG_ZPP_THREAD_STATS
+ZPP_ZTEST(zpp_thread, test_stats) {
+  // TESTPOINT: the statistics reflect the time spent running and waiting and the stack usage
+  using std::literals::chrono_literals::operator""ms;
+  static constexpr auto kBusyWaitDuration = 20ms;
+  static constexpr auto kSleepDuration    = 20ms;
+  static constexpr uint8_t kNbrOfSleeps   = 5;
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "stats_thread", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "stats_thread");
+#endif  // CONFIG_USERSPACE
+
+  zpp_lib::ThreadStats stats;
+  auto res = thread.get_stats(stats);
+  zpp_zassert_true(!res && res.error() == zpp_lib::ZephyrErrorCode::Srch, "Got stats of a thread not started");
+
+  static zpp_lib::Semaphore s_done(0, 1);
+  static zpp_lib::Semaphore s_resume(0, 1);
+  res = thread.start([]() {
+    zpp_lib::ThisThread::busy_wait(kBusyWaitDuration);
+    for (uint8_t i = 0; i < kNbrOfSleeps; i++) {
+      zpp_lib::ThisThread::sleep_for(kSleepDuration);
+    }
+    auto sem_res = s_done.release();
+    zpp_zassert_true(sem_res, "Cannot release semaphore");
+    sem_res = s_resume.acquire();
+    zpp_zassert_true(sem_res, "Cannot acquire semaphore");
+  });
+  zpp_zassert_true(res, "Cannot start thread");
+  zpp_zassert_true(s_done.acquire(), "Cannot acquire semaphore");
+
+  // the thread is now blocked
+  res = thread.get_stats(stats);
+  zpp_zassert_true(res, "Cannot get thread stats: %d", static_cast<int>(res.error()));
+  zpp_zassert_true(stats.execution_cycles > 0, "No execution cycles");
+  zpp_zassert_true(stats.nbr_of_schedules > kNbrOfSleeps, "Wrong number of schedules: %u", stats.nbr_of_schedules);
+  zpp_zassert_true(stats.peak_cycles >= stats.average_cycles, "Peak cycles smaller than average");
+  zpp_zassert_true(stats.running_time >= kBusyWaitDuration, "Running time too short: %lld", stats.running_time.count());
+  zpp_zassert_true(stats.waiting_time >= kNbrOfSleeps * kSleepDuration, "Waiting time too short: %lld", stats.waiting_time.count());
+  zpp_zassert_true(stats.stack_high_watermark > 0 && stats.stack_high_watermark <= stats.stack_size,
+                   "Wrong stack high watermark: %zu/%zu",
+                   stats.stack_high_watermark,
+                   stats.stack_size);
+
+  zpp_zassert_true(s_resume.release(), "Cannot release semaphore");
+  zpp_zassert_true(thread.join(), "Cannot join thread");
+}
+#endif  // CONFIG_ZPP_THREAD_STATS
+
 ZPP_ZTEST_SUITE(zpp_thread, nullptr, nullptr, nullptr, nullptr, nullptr);
@@ -0,0 +1,219 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_thread_cooperative.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for cooperative zpp_lib threads and work queues
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+#include <atomic>
+#include <chrono>
+
+// zpp_rtos
+#include "zpp_include/mutex.hpp"
+#include "zpp_include/semaphore.hpp"
+#include "zpp_include/this_thread.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/work.hpp"
+#include "zpp_include/work_queue.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_log.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+// test helpers
+#include "zpp_benchmark.hpp"
+
+ZPP_LOG_MODULE_REGISTER(test_thread_cooperative, CONFIG_APP_LOG_LEVEL);
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+
+constexpr auto kSuiteName         = "thread_cooperative";
+constexpr uint32_t kNbrOfItems    = 1000;
+constexpr uint32_t kNbrOfRuns     = 10;
+constexpr uint32_t kBufferSize    = 16;
+constexpr auto kBusyWaitDuration  = 5ms;
+constexpr uint32_t kExpectedTotal = kNbrOfItems * (kNbrOfItems - 1) / 2;
+
+// buffer shared by the two stages of the pipeline
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<uint32_t, kBufferSize> s_buffer = {};
+uint32_t s_total                           = 0;
+uint32_t s_start_cycles                    = 0;
+uint32_t s_end_cycles                      = 0;
+zpp_lib::Semaphore s_items(0, kBufferSize);
+zpp_lib::Semaphore s_spaces(kBufferSize, kBufferSize);
+zpp_lib::Semaphore s_consumer_done(0, 1);
+zpp_lib::Mutex s_mutex;
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+// producer stage: the buffer is locked only if the stages may preempt each other
+template <bool UseLock>
+void produce() {
+  s_start_cycles = zpp_lib::benchmark::cycles_now();
+  for (uint32_t i = 0; i < kNbrOfItems; i++) {
+    zpp_zassert_true(s_spaces.acquire(), "Cannot acquire space");
+    if constexpr (UseLock) {
+      zpp_zassert_true(s_mutex.lock(), "Cannot lock mutex");
+    }
+    s_buffer[i % kBufferSize] = i;
+    if constexpr (UseLock) {
+      zpp_zassert_true(s_mutex.unlock(), "Cannot unlock mutex");
+    }
+    zpp_zassert_true(s_items.release(), "Cannot release item");
+  }
+}
+
+// consumer stage
+template <bool UseLock>
+void consume() {
+  for (uint32_t i = 0; i < kNbrOfItems; i++) {
+    zpp_zassert_true(s_items.acquire(), "Cannot acquire item");
+    if constexpr (UseLock) {
+      zpp_zassert_true(s_mutex.lock(), "Cannot lock mutex");
+    }
+    s_total += s_buffer[i % kBufferSize];
+    if constexpr (UseLock) {
+      zpp_zassert_true(s_mutex.unlock(), "Cannot unlock mutex");
+    }
+    zpp_zassert_true(s_spaces.release(), "Cannot release space");
+  }
+  s_end_cycles = zpp_lib::benchmark::cycles_now();
+  zpp_zassert_true(s_consumer_done.release(), "Cannot release semaphore");
+}
+
+// runs the pipeline kNbrOfRuns times with the given priorities and reports the cycles
+// per run and the number of context switches per run
+template <bool UseLock, typename Priority>
+void run_pipeline(Priority producer_priority, Priority consumer_priority, const char* cycles_name, const char* switches_name) {
+  zpp_lib::benchmark::CycleStats cycle_stats;
+  uint32_t nbr_of_schedules = 0;
+  for (uint32_t run = 0; run < kNbrOfRuns; run++) {
+#if CONFIG_USERSPACE
+    zpp_lib::Thread producer(producer_priority, "producer", false);
+    zpp_lib::Thread consumer(consumer_priority, "consumer", false);
+#else   // CONFIG_USERSPACE
+    zpp_lib::Thread producer(producer_priority, "producer");
+    zpp_lib::Thread consumer(consumer_priority, "consumer");
+#endif  // CONFIG_USERSPACE
+    s_total  = 0;
+    auto res = consumer.start(consume<UseLock>);
+    zpp_zassert_true(res, "Cannot start consumer");
+    res = producer.start(produce<UseLock>);
+    zpp_zassert_true(res, "Cannot start producer");
+
+    // collect the statistics before joining the stages
+    zpp_zassert_true(s_consumer_done.acquire(), "Cannot wait for consumer");
+    zpp_zassert_equal(s_total, kExpectedTotal, "Wrong total: %u", s_total);
+    zpp_lib::ThreadStats producer_stats;
+    zpp_lib::ThreadStats consumer_stats;
+    zpp_zassert_true(producer.get_stats(producer_stats), "Cannot get producer stats");
+    zpp_zassert_true(consumer.get_stats(consumer_stats), "Cannot get consumer stats");
+    nbr_of_schedules += producer_stats.nbr_of_schedules + consumer_stats.nbr_of_schedules;
+    cycle_stats.add(s_end_cycles - s_start_cycles);
+
+    zpp_zassert_true(producer.join(), "Cannot join producer");
+    zpp_zassert_true(consumer.join(), "Cannot join consumer");
+  }
+  cycle_stats.report(kSuiteName, cycles_name);
+  zpp_lib::benchmark::report_value(kSuiteName, switches_name, "switches", nbr_of_schedules / kNbrOfRuns);
+}
+
+// work item recording whether it was preempted
+class CheckWork {
+public:
+  explicit CheckWork(zpp_lib::Semaphore& done) : _done(done) {}
+
+  void run() {
+    _was_cooperative = zpp_lib::ThisThread::is_cooperative();
+    auto res         = _done.release();
+    zpp_zassert_true(res, "Cannot release semaphore");
+  }
+
+  [[nodiscard]] bool was_cooperative() const {
+    return _was_cooperative;
+  }
+
+private:
+  zpp_lib::Semaphore& _done;
+  // written by the work queue thread
+  std::atomic<bool> _was_cooperative = false;
+};
+
+}  // namespace
+
+ZPP_ZTEST(zpp_thread_cooperative, test_not_preempted) {
+  // TESTPOINT: a cooperative thread is not preempted by a higher priority preemptable thread
+  // written by the preemptable thread
+  static std::atomic<bool> s_has_run = false;
+  s_has_run     = false;
+  auto priority = zpp_lib::ThisThread::get_priority();
+  zpp_lib::ThisThread::set_priority(zpp_lib::CooperativeThreadPriority::PriorityLow);
+  zpp_zassert_true(zpp_lib::ThisThread::is_cooperative(), "Thread is not cooperative");
+
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityRealtime, "realtime_thread", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityRealtime, "realtime_thread");
+#endif  // CONFIG_USERSPACE
+  auto res = thread.start([]() { s_has_run = true; });
+  zpp_zassert_true(res, "Cannot start thread");
+  zpp_lib::ThisThread::busy_wait(kBusyWaitDuration);
+  zpp_zassert_true(!s_has_run, "Cooperative thread was preempted");
+
+  // sleeping lets the other thread run
+  zpp_lib::ThisThread::sleep_for(1ms);
+  zpp_zassert_true(s_has_run, "Preemptable thread did not run");
+  zpp_zassert_true(thread.join(), "Cannot join thread");
+  zpp_lib::ThisThread::set_priority(priority);
+}
+
+ZPP_ZTEST(zpp_thread_cooperative, test_cooperative_work_queue) {
+  // TESTPOINT: work items of a cooperative work queue run in a cooperative thread
+#if CONFIG_USERSPACE
+  zpp_lib::WorkQueue work_queue("coop_work_queue", zpp_lib::CooperativeThreadPriority::PriorityNormal, false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::WorkQueue work_queue("coop_work_queue", zpp_lib::CooperativeThreadPriority::PriorityNormal);
+#endif  // CONFIG_USERSPACE
+  zpp_lib::Semaphore done(0, 1);
+  CheckWork check_work(done);
+  zpp_lib::Work<CheckWork> work(&check_work, &CheckWork::run);
+  zpp_zassert_true(work_queue.call(work), "Cannot submit work");
+  zpp_zassert_true(done.acquire(), "Cannot wait for work");
+  zpp_zassert_true(check_work.was_cooperative(), "Work did not run in a cooperative thread");
+  zpp_zassert_true(work_queue.stop(), "Cannot stop work queue");
+}
+
+ZPP_ZTEST(zpp_thread_cooperative, test_benchmark_pipeline) {
+  // compare a two stage pipeline with preemptable stages protecting the shared buffer
+  // with a mutex, and with cooperative stages that run to completion without lock
+  run_pipeline<true>(zpp_lib::PreemptableThreadPriority::PriorityNormal,
+                     zpp_lib::PreemptableThreadPriority::PriorityAboveNormal,
+                     "preemptable_pipeline_1000_items",
+                     "preemptable_pipeline_context_switches");
+  run_pipeline<false>(zpp_lib::CooperativeThreadPriority::PriorityNormal,
+                      zpp_lib::CooperativeThreadPriority::PriorityHigh,
+                      "cooperative_pipeline_1000_items",
+                      "cooperative_pipeline_context_switches");
+}
+
+ZPP_ZTEST_SUITE(zpp_thread_cooperative, nullptr, nullptr, nullptr, nullptr, nullptr);
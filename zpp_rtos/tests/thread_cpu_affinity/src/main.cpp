@@ -0,0 +1,144 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_thread_cpu_affinity.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for the CPU affinity of zpp_lib Thread class (SMP targets)
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// std
+#include <array>
+#include <atomic>
+#include <chrono>
+
+// zpp_rtos
+#include "zpp_include/this_thread.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_log.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+ZPP_LOG_MODULE_REGISTER(test_thread_cpu_affinity, CONFIG_APP_LOG_LEVEL);
+
+namespace {
+
+using std::literals::chrono_literals::operator""us;
+using std::literals::chrono_literals::operator""ms;
+
+constexpr uint8_t kNbrOfCpus     = CONFIG_MP_MAX_NUM_CPUS;
+constexpr uint32_t kNbrOfChecks  = 1000;
+constexpr auto kBusyWaitDuration = 50us;
+constexpr auto kSleepDuration    = 1ms;
+constexpr uint32_t kSleepPeriod  = 100;
+
+// results written by the pinned threads
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<std::atomic<uint32_t>, kNbrOfCpus> s_nbr_of_migrations = {};
+std::array<std::atomic<uint32_t>, kNbrOfCpus> s_cpu_masks         = {};
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+// checks repeatedly on which CPU the thread runs, giving the scheduler many
+// opportunities to migrate the thread
+void check_cpu(uint8_t expected_cpu) {
+  s_cpu_masks[expected_cpu] = zpp_lib::ThisThread::get_cpu_mask();
+  for (uint32_t i = 0; i < kNbrOfChecks; i++) {
+    if (zpp_lib::ThisThread::get_cpu() != expected_cpu) {
+      s_nbr_of_migrations[expected_cpu]++;
+    }
+    zpp_lib::ThisThread::busy_wait(kBusyWaitDuration);
+    if (i % kSleepPeriod == 0) {
+      zpp_lib::ThisThread::sleep_for(kSleepDuration);
+    } else {
+      k_yield();
+    }
+  }
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_thread_cpu_affinity, test_pinned_threads_stay_on_cpu) {
+  // TESTPOINT: threads pinned to a CPU never run on another CPU
+  zpp_zassert_equal(arch_num_cpus(), kNbrOfCpus, "Test requires %d CPUs", kNbrOfCpus);
+
+  // one more thread than CPUs competing with the pinned threads
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread0(zpp_lib::PreemptableThreadPriority::PriorityNormal, "pinned_thread0", false);
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "pinned_thread1", false);
+  zpp_lib::Thread free_thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "free_thread", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread0(zpp_lib::PreemptableThreadPriority::PriorityNormal, "pinned_thread0");
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "pinned_thread1");
+  zpp_lib::Thread free_thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "free_thread");
+#endif  // CONFIG_USERSPACE
+  zpp_zassert_true(free_thread.get_cpu_mask() == zpp_lib::Thread::kAllCpusMask, "Wrong default CPU mask");
+  std::array<zpp_lib::Thread*, kNbrOfCpus> threads = {&thread0, &thread1};
+
+  for (uint8_t cpu = 0; cpu < kNbrOfCpus; cpu++) {
+    s_nbr_of_migrations[cpu] = 0;
+    zpp_zassert_true(threads[cpu]->pin_to_cpu(cpu), "Cannot pin thread to CPU %d", cpu);
+    zpp_zassert_equal(threads[cpu]->get_cpu_mask(), BIT(cpu), "Wrong CPU mask");
+  }
+  auto res = thread0.start([]() { check_cpu(0); });
+  zpp_zassert_true(res, "Cannot start thread pinned to CPU 0");
+  res = thread1.start([]() { check_cpu(1); });
+  zpp_zassert_true(res, "Cannot start thread pinned to CPU 1");
+  res = free_thread.start([]() {
+    for (uint32_t i = 0; i < kNbrOfChecks; i++) {
+      zpp_lib::ThisThread::busy_wait(kBusyWaitDuration);
+      k_yield();
+    }
+  });
+  zpp_zassert_true(res, "Cannot start free thread");
+
+  for (auto* p_thread : threads) {
+    zpp_zassert_true(p_thread->join(), "Cannot join pinned thread");
+  }
+  zpp_zassert_true(free_thread.join(), "Cannot join free thread");
+
+  for (uint8_t cpu = 0; cpu < kNbrOfCpus; cpu++) {
+    zpp_zassert_equal(s_cpu_masks[cpu], BIT(cpu), "Thread pinned to CPU %d has mask 0x%x", cpu, s_cpu_masks[cpu].load());
+    zpp_zassert_equal(s_nbr_of_migrations[cpu], 0, "Thread pinned to CPU %d ran %d times on another CPU", cpu, s_nbr_of_migrations[cpu].load());
+  }
+}
+
+ZPP_ZTEST(zpp_thread_cpu_affinity, test_invalid_cpu_mask) {
+  // TESTPOINT: invalid masks are rejected, and the mask cannot be modified once started
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "masked_thread", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "masked_thread");
+#endif  // CONFIG_USERSPACE
+  auto res = thread.set_cpu_mask(0);
+  zpp_zassert_true(!res && res.error() == zpp_lib::ZephyrErrorCode::Inval, "Empty CPU mask accepted");
+  res = thread.set_cpu_mask(BIT(kNbrOfCpus));
+  zpp_zassert_true(!res && res.error() == zpp_lib::ZephyrErrorCode::Inval, "Mask with non existing CPU accepted");
+  res = thread.pin_to_cpu(kNbrOfCpus);
+  zpp_zassert_true(!res && res.error() == zpp_lib::ZephyrErrorCode::Inval, "Non existing CPU accepted");
+
+  res = thread.start([]() {});
+  zpp_zassert_true(res, "Cannot start thread");
+  res = thread.pin_to_cpu(0);
+  zpp_zassert_true(!res && res.error() == zpp_lib::ZephyrErrorCode::Already, "CPU mask modified after start");
+  zpp_zassert_true(thread.join(), "Cannot join thread");
+}
+
+ZPP_ZTEST_SUITE(zpp_thread_cpu_affinity, nullptr, nullptr, nullptr, nullptr, nullptr);
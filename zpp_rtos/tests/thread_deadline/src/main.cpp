@@ -0,0 +1,155 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_thread_deadline.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for earliest deadline first scheduling of zpp_lib threads
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+#include <atomic>
+#include <chrono>
+
+// zpp_rtos
+#include "zpp_include/this_thread.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/time.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_log.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+ZPP_LOG_MODULE_REGISTER(test_thread_deadline, CONFIG_APP_LOG_LEVEL);
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+
+constexpr uint8_t kNbrOfThreads  = 3;
+constexpr uint8_t kNbrOfPeriods  = 5;
+constexpr auto kBusyWaitDuration = 1ms;
+
+// order in which the threads ran
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<uint8_t, kNbrOfThreads * kNbrOfPeriods> s_order = {};
+std::atomic<uint8_t> s_nbr_of_runs                         = 0;
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+void record_run(uint8_t thread_index) {
+  uint8_t index = s_nbr_of_runs++;
+  if (index < s_order.size()) {
+    s_order[index] = thread_index;
+  }
+  // keep the CPU, so that other threads cannot run before this one is done
+  zpp_lib::ThisThread::busy_wait(kBusyWaitDuration);
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_thread_deadline, test_edf_ordering) {
+  // TESTPOINT: threads of equal priority run in the order of their deadlines,
+  // not in the order in which they were started
+  static constexpr std::array<std::chrono::microseconds, kNbrOfThreads> kDeadlines = {30ms, 10ms, 20ms};
+  static constexpr std::array<uint8_t, kNbrOfThreads> kExpectedOrder               = {1, 2, 0};
+  s_nbr_of_runs                                                                    = 0;
+
+  // prevent the threads from running until they are all started
+  auto priority = zpp_lib::ThisThread::get_priority();
+  zpp_lib::ThisThread::set_priority(zpp_lib::CooperativeThreadPriority::PriorityLow);
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread0(zpp_lib::PreemptableThreadPriority::PriorityNormal, "edf_thread0", false);
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "edf_thread1", false);
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "edf_thread2", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread0(zpp_lib::PreemptableThreadPriority::PriorityNormal, "edf_thread0");
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "edf_thread1");
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "edf_thread2");
+#endif  // CONFIG_USERSPACE
+  std::array<zpp_lib::Thread*, kNbrOfThreads> threads = {&thread0, &thread1, &thread2};
+  for (uint8_t i = 0; i < kNbrOfThreads; i++) {
+    zpp_zassert_true(threads[i]->set_deadline(kDeadlines[i]), "Cannot set deadline of thread %d", i);
+  }
+  auto res = thread0.set_deadline(0ms);
+  zpp_zassert_true(!res && res.error() == zpp_lib::ZephyrErrorCode::Inval, "Null deadline accepted");
+
+  res = thread0.start([]() { record_run(0); });
+  zpp_zassert_true(res, "Cannot start thread 0");
+  res = thread1.start([]() { record_run(1); });
+  zpp_zassert_true(res, "Cannot start thread 1");
+  res = thread2.start([]() { record_run(2); });
+  zpp_zassert_true(res, "Cannot start thread 2");
+
+  for (auto* p_thread : threads) {
+    zpp_zassert_true(p_thread->join(), "Cannot join thread");
+  }
+  zpp_lib::ThisThread::set_priority(priority);
+
+  zpp_zassert_equal(s_nbr_of_runs.load(), kNbrOfThreads, "Wrong number of runs");
+  for (uint8_t i = 0; i < kNbrOfThreads; i++) {
+    zpp_zassert_equal(s_order[i], kExpectedOrder[i], "Wrong order at %d: thread %d", i, s_order[i]);
+  }
+}
+
+ZPP_ZTEST(zpp_thread_deadline, test_periodic_release) {
+  // TESTPOINT: periodic threads released at the same time run in the order of the
+  // deadline re-armed at each release
+  static constexpr auto kPeriod = 10ms;
+  static constexpr std::array<std::chrono::microseconds, kNbrOfThreads> kRelativeDeadlines = {8ms, 4ms, 6ms};
+  static constexpr std::array<uint8_t, kNbrOfThreads> kExpectedOrder                       = {1, 2, 0};
+  static std::chrono::microseconds s_first_release(0);
+  s_nbr_of_runs   = 0;
+  s_first_release = zpp_lib::Time::get_uptime() + kPeriod;
+
+  static auto s_periodic_task = [](uint8_t thread_index) {
+    for (uint8_t period = 0; period < kNbrOfPeriods; period++) {
+      zpp_lib::ThisThread::release_at(s_first_release + period * kPeriod, kRelativeDeadlines[thread_index]);
+      record_run(thread_index);
+    }
+  };
+
+#if CONFIG_USERSPACE
+  zpp_lib::Thread thread0(zpp_lib::PreemptableThreadPriority::PriorityNormal, "periodic_thread0", false);
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "periodic_thread1", false);
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "periodic_thread2", false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::Thread thread0(zpp_lib::PreemptableThreadPriority::PriorityNormal, "periodic_thread0");
+  zpp_lib::Thread thread1(zpp_lib::PreemptableThreadPriority::PriorityNormal, "periodic_thread1");
+  zpp_lib::Thread thread2(zpp_lib::PreemptableThreadPriority::PriorityNormal, "periodic_thread2");
+#endif  // CONFIG_USERSPACE
+  auto res = thread0.start([]() { s_periodic_task(0); });
+  zpp_zassert_true(res, "Cannot start thread 0");
+  res = thread1.start([]() { s_periodic_task(1); });
+  zpp_zassert_true(res, "Cannot start thread 1");
+  res = thread2.start([]() { s_periodic_task(2); });
+  zpp_zassert_true(res, "Cannot start thread 2");
+
+  zpp_zassert_true(thread0.join(), "Cannot join thread 0");
+  zpp_zassert_true(thread1.join(), "Cannot join thread 1");
+  zpp_zassert_true(thread2.join(), "Cannot join thread 2");
+
+  zpp_zassert_equal(s_nbr_of_runs.load(), kNbrOfThreads * kNbrOfPeriods, "Wrong number of runs");
+  for (uint8_t period = 0; period < kNbrOfPeriods; period++) {
+    for (uint8_t i = 0; i < kNbrOfThreads; i++) {
+      uint8_t thread_index = s_order[(period * kNbrOfThreads) + i];
+      zpp_zassert_equal(thread_index, kExpectedOrder[i], "Wrong order in period %d at %d: thread %d", period, i, thread_index);
+    }
+  }
+}
+
+ZPP_ZTEST_SUITE(zpp_thread_deadline, nullptr, nullptr, nullptr, nullptr, nullptr);
@@ -0,0 +1,139 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_thread_lifecycle.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Benchmark of the lifecycle of zpp_lib threads (start, wait_started, join)
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <atomic>
+
+// zephyr
+#include <zephyr/kernel.h>
+#if CONFIG_USERSPACE
+#include <zephyr/app_memory/app_memdomain.h>
+#endif  // CONFIG_USERSPACE
+
+// zpp_rtos
+#include "zpp_include/this_thread.hpp"
+#include "zpp_include/thread.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_log.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+// test helpers
+#include "zpp_benchmark.hpp"
+
+ZPP_LOG_MODULE_REGISTER(test_thread_lifecycle, CONFIG_APP_LOG_LEVEL);
+
+#if CONFIG_USERSPACE
+// partition of the zpp_lib data, to be added to the memory domain of user threads
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+K_APPMEM_PARTITION_DEFINE(zpp_lib_partition);
+#endif  // CONFIG_USERSPACE
+
+namespace {
+
+constexpr auto kKernelModeSuiteName = "thread_lifecycle_kernel";
+constexpr auto kUserModeSuiteName   = "thread_lifecycle_user";
+constexpr uint32_t kNbrOfIterations = 100;
+
+// the benchmarked thread has a lower priority than the benchmarking thread, so that
+// start() returns before the new thread runs and wait_started() includes the
+// start event handshake done in Thread::s_thunk
+constexpr auto kCallerPriority = zpp_lib::PreemptableThreadPriority::PriorityNormal;
+constexpr auto kThreadPriority = zpp_lib::PreemptableThreadPriority::PriorityBelowNormal;
+
+// cycle counter value read by the benchmarked thread when it starts running
+ZTEST_BMEM std::atomic<uint32_t> s_run_cycles = 0;
+
+struct LifecycleStats {
+  zpp_lib::benchmark::CycleStats start;
+  zpp_lib::benchmark::CycleStats dispatch;
+  zpp_lib::benchmark::CycleStats wait_started;
+  zpp_lib::benchmark::CycleStats join;
+  zpp_lib::benchmark::CycleStats lifecycle;
+
+  void report(const char* suite) const {
+    start.report(suite, "start");
+    dispatch.report(suite, "start_to_run");
+    wait_started.report(suite, "wait_started");
+    join.report(suite, "join");
+    lifecycle.report(suite, "construct_to_destruct");
+  }
+};
+
+// measures each step of the lifecycle of a thread created in the given mode
+void benchmark_lifecycle([[maybe_unused]] bool user_mode, const char* suite) {
+  zpp_lib::ThisThread::set_priority(kCallerPriority);
+  LifecycleStats stats;
+  for (uint32_t i = 0; i < kNbrOfIterations; i++) {
+    uint32_t construct_cycles = zpp_lib::benchmark::cycles_now();
+    {
+#if CONFIG_USERSPACE
+      zpp_lib::Thread thread(kThreadPriority, "bench_thread", user_mode);
+#else   // CONFIG_USERSPACE
+      zpp_lib::Thread thread(kThreadPriority, "bench_thread");
+#endif  // CONFIG_USERSPACE
+      uint32_t start_cycles   = zpp_lib::benchmark::cycles_now();
+      auto res                = thread.start([]() { s_run_cycles = zpp_lib::benchmark::cycles_now(); });
+      uint32_t started_cycles = zpp_lib::benchmark::cycles_now();
+      zpp_zassert_true(res, "Cannot start thread: %d", static_cast<int>(res.error()));
+
+      thread.wait_started();
+      uint32_t wait_cycles = zpp_lib::benchmark::cycles_now();
+
+      res                  = thread.join();
+      uint32_t join_cycles = zpp_lib::benchmark::cycles_now();
+      zpp_zassert_true(res, "Cannot join thread: %d", static_cast<int>(res.error()));
+
+      stats.start.add(started_cycles - start_cycles);
+      stats.dispatch.add(s_run_cycles - start_cycles);
+      stats.wait_started.add(wait_cycles - started_cycles);
+      stats.join.add(join_cycles - wait_cycles);
+    }
+    stats.lifecycle.add(zpp_lib::benchmark::cycles_now() - construct_cycles);
+  }
+  stats.report(suite);
+}
+
+void* suite_setup() {
+#if CONFIG_USERSPACE
+  auto ret = k_mem_domain_add_partition(&k_mem_domain_default, &zpp_lib_partition);
+  zpp_zassert_equal(ret, 0, "Cannot add zpp_lib partition: %d", ret);
+#endif  // CONFIG_USERSPACE
+  return nullptr;
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_thread_lifecycle, test_benchmark_kernel_mode) {
+  // threads created by a supervisor thread in kernel mode
+  benchmark_lifecycle(false, kKernelModeSuiteName);
+}
+
+#if CONFIG_USERSPACE
+ZPP_ZTEST_USER(zpp_thread_lifecycle, test_benchmark_user_mode) {
+  // threads created by a user thread in user mode
+  benchmark_lifecycle(true, kUserModeSuiteName);
+}
+#endif  // CONFIG_USERSPACE
+
+ZPP_ZTEST_SUITE(zpp_thread_lifecycle, nullptr, suite_setup, nullptr, nullptr, nullptr);
@@ -0,0 +1,247 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_thread_pool.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib ThreadPool class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <utility>
+
+// zpp_rtos
+#include "zpp_include/semaphore.hpp"
+#include "zpp_include/this_thread.hpp"
+#include "zpp_include/thread_pool.hpp"
+#include "zpp_include/work.hpp"
+#include "zpp_include/work_queue.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_log.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+// test helpers
+#include "zpp_benchmark.hpp"
+
+ZPP_LOG_MODULE_REGISTER(test_thread_pool, CONFIG_APP_LOG_LEVEL);
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+
+constexpr auto kSuiteName           = "thread_pool";
+constexpr size_t kNbrOfWorkers      = 4;
+constexpr size_t kQueueSize         = 16;
+constexpr uint32_t kNbrOfJobs       = 64;
+constexpr uint32_t kNbrOfIterations = 100;
+constexpr uint32_t kJobLoad         = 200;
+
+using TestThreadPool = zpp_lib::ThreadPool<kNbrOfWorkers, kQueueSize>;
+
+// the pool is large and is thus allocated statically
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TestThreadPool* p_pool = nullptr;
+
+// short computation simulating a job, jobs run concurrently on several workers and
+// each job thus computes on its own value. The compiler does not optimize out the
+// atomic accesses.
+void do_job_load() {
+  std::atomic<uint32_t> value = 0;
+  for (uint32_t i = 0; i < kJobLoad; i++) {
+    value.store(value.load(std::memory_order_relaxed) + i, std::memory_order_relaxed);
+  }
+}
+
+// job executed by the work queue, signaling its completion with a semaphore
+class BenchWork {
+public:
+  explicit BenchWork(zpp_lib::Semaphore& done) : _done(done) {}
+
+  void run() {
+    _start_cycles = zpp_lib::benchmark::cycles_now();
+    do_job_load();
+    auto res = _done.release();
+    zpp_zassert_true(res, "Cannot release semaphore");
+  }
+
+  [[nodiscard]] uint32_t get_start_cycles() const {
+    return _start_cycles;
+  }
+
+private:
+  zpp_lib::Semaphore& _done;
+  // written by the work queue thread
+  std::atomic<uint32_t> _start_cycles = 0;
+};
+
+template <size_t... Indexes>
+std::array<zpp_lib::Work<BenchWork>, sizeof...(Indexes)> make_works(BenchWork* p_bench_work, std::index_sequence<Indexes...> /*unused*/) {
+  return {{(static_cast<void>(Indexes), zpp_lib::Work<BenchWork>(p_bench_work, &BenchWork::run))...}};
+}
+
+void* suite_setup() {
+  static TestThreadPool s_pool("pool_worker");
+  p_pool = &s_pool;
+  return nullptr;
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_thread_pool, test_submit_and_wait) {
+  // TESTPOINT: all submitted jobs are executed
+  static std::atomic<uint32_t> s_nbr_of_executed_jobs = 0;
+  s_nbr_of_executed_jobs                              = 0;
+  std::array<TestThreadPool::JobHandle, kQueueSize> handles;
+  for (auto& handle : handles) {
+    handle = p_pool->submit([]() {
+      do_job_load();
+      s_nbr_of_executed_jobs++;
+    });
+    zpp_zassert_true(handle.is_valid(), "Cannot submit job");
+  }
+  for (auto& handle : handles) {
+    zpp_zassert_true(handle.wait(), "Cannot wait for job");
+  }
+  zpp_zassert_equal(s_nbr_of_executed_jobs.load(), kQueueSize, "Not all jobs were executed");
+}
+
+ZPP_ZTEST(zpp_thread_pool, test_nested_submit) {
+  // TESTPOINT: jobs submitted from a worker are executed (by the same worker or stolen)
+  static std::atomic<uint32_t> s_nbr_of_executed_jobs = 0;
+  s_nbr_of_executed_jobs                              = 0;
+  static constexpr uint32_t kNbrOfNestedJobs          = 4;
+  auto handle                                         = p_pool->submit([]() {
+    for (uint32_t i = 0; i < kNbrOfNestedJobs; i++) {
+      // the nested handles are released immediately: the jobs are detached
+      auto nested_handle = p_pool->submit([]() {
+        do_job_load();
+        s_nbr_of_executed_jobs++;
+      });
+      zpp_zassert_true(nested_handle.is_valid(), "Cannot submit nested job");
+    }
+  });
+  zpp_zassert_true(handle.wait(), "Cannot wait for job");
+
+  // wait for the detached jobs
+  static constexpr auto kPollPeriod = 1ms;
+  for (uint32_t i = 0; i < kNbrOfIterations && s_nbr_of_executed_jobs.load() < kNbrOfNestedJobs; i++) {
+    zpp_lib::ThisThread::sleep_for(kPollPeriod);
+  }
+  zpp_zassert_equal(s_nbr_of_executed_jobs.load(), kNbrOfNestedJobs, "Not all nested jobs were executed");
+}
+
+ZPP_ZTEST(zpp_thread_pool, test_bounded_queue) {
+  // TESTPOINT: submitting fails when all job slots are in use, and a job that is
+  // blocked can be waited for with a timeout
+  zpp_lib::Semaphore unblock(0, kQueueSize);
+  std::array<TestThreadPool::JobHandle, kQueueSize> handles;
+  for (auto& handle : handles) {
+    handle = p_pool->submit([&unblock]() {
+      auto res = unblock.acquire();
+      zpp_zassert_true(res, "Cannot acquire semaphore");
+    });
+    zpp_zassert_true(handle.is_valid(), "Cannot submit job");
+  }
+  auto handle = p_pool->try_submit_for([]() {}, 10ms);
+  zpp_zassert_true(!handle.is_valid(), "Job was submitted with a full queue");
+
+  auto wait_res = handles[0].try_wait_for(10ms);
+  zpp_zassert_true(!wait_res.has_error(), "Cannot wait for job");
+  zpp_zassert_true(!wait_res, "Blocked job was reported as executed");
+
+  for (size_t i = 0; i < kQueueSize; i++) {
+    zpp_zassert_true(unblock.release(), "Cannot release semaphore");
+  }
+  for (auto& blocked_handle : handles) {
+    zpp_zassert_true(blocked_handle.wait(), "Cannot wait for job");
+  }
+}
+
+ZPP_ZTEST(zpp_thread_pool, test_benchmark_throughput) {
+  // compare the time needed for executing kNbrOfJobs jobs with the pool and with a
+  // single work queue
+  zpp_lib::benchmark::measure(kNbrOfIterations, []() {
+    std::array<TestThreadPool::JobHandle, kQueueSize> handles;
+    for (uint32_t i = 0; i < kNbrOfJobs; i++) {
+      auto& handle = handles[i % kQueueSize];
+      if (handle.is_valid()) {
+        zpp_zassert_true(handle.wait(), "Cannot wait for job");
+      }
+      handle = p_pool->submit(do_job_load);
+    }
+    for (auto& handle : handles) {
+      zpp_zassert_true(handle.wait(), "Cannot wait for job");
+    }
+  }).report(kSuiteName, "thread_pool_64_jobs");
+
+#if CONFIG_USERSPACE
+  zpp_lib::WorkQueue work_queue("work_queue", zpp_lib::PreemptableThreadPriority::PriorityNormal, false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::WorkQueue work_queue("work_queue", zpp_lib::PreemptableThreadPriority::PriorityNormal);
+#endif  // CONFIG_USERSPACE
+  static zpp_lib::Semaphore s_done(0, kNbrOfJobs);
+  static BenchWork s_bench_work(s_done);
+  // a work item cannot be queued more than once, use one work item per job
+  static auto s_works = make_works(&s_bench_work, std::make_index_sequence<kNbrOfJobs>{});
+  zpp_lib::benchmark::measure(kNbrOfIterations, [&work_queue]() {
+    for (auto& work : s_works) {
+      zpp_zassert_true(work_queue.call(work), "Cannot submit work");
+    }
+    for (uint32_t i = 0; i < kNbrOfJobs; i++) {
+      zpp_zassert_true(s_done.acquire(), "Cannot wait for work");
+    }
+  }).report(kSuiteName, "work_queue_64_jobs");
+  zpp_zassert_true(work_queue.stop(), "Cannot stop work queue");
+}
+
+ZPP_ZTEST(zpp_thread_pool, test_benchmark_latency) {
+  // compare the latency between submitting a job and the job start
+  // written by the workers
+  static std::atomic<uint32_t> s_start_cycles = 0;
+  zpp_lib::benchmark::CycleStats pool_stats;
+  for (uint32_t i = 0; i < kNbrOfIterations; i++) {
+    uint32_t submit_cycles = zpp_lib::benchmark::cycles_now();
+    auto handle            = p_pool->submit([]() { s_start_cycles = zpp_lib::benchmark::cycles_now(); });
+    zpp_zassert_true(handle.wait(), "Cannot wait for job");
+    pool_stats.add(s_start_cycles - submit_cycles);
+  }
+  pool_stats.report(kSuiteName, "thread_pool_latency");
+
+#if CONFIG_USERSPACE
+  zpp_lib::WorkQueue work_queue("work_queue", zpp_lib::PreemptableThreadPriority::PriorityNormal, false);
+#else   // CONFIG_USERSPACE
+  zpp_lib::WorkQueue work_queue("work_queue", zpp_lib::PreemptableThreadPriority::PriorityNormal);
+#endif  // CONFIG_USERSPACE
+  zpp_lib::Semaphore done(0, 1);
+  BenchWork bench_work(done);
+  zpp_lib::Work<BenchWork> work(&bench_work, &BenchWork::run);
+  zpp_lib::benchmark::CycleStats work_queue_stats;
+  for (uint32_t i = 0; i < kNbrOfIterations; i++) {
+    uint32_t submit_cycles = zpp_lib::benchmark::cycles_now();
+    zpp_zassert_true(work_queue.call(work), "Cannot submit work");
+    zpp_zassert_true(done.acquire(), "Cannot wait for work");
+    work_queue_stats.add(bench_work.get_start_cycles() - submit_cycles);
+  }
+  work_queue_stats.report(kSuiteName, "work_queue_latency");
+  zpp_zassert_true(work_queue.stop(), "Cannot stop work queue");
+}
+
+ZPP_ZTEST_SUITE(zpp_thread_pool, nullptr, suite_setup, nullptr, nullptr, nullptr);
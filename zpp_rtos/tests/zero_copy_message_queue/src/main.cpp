@@ -0,0 +1,159 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_zero_copy_message_queue.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for zpp_lib ZeroCopyMessageQueue class
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+// std
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+// zpp_rtos
+#include "zpp_include/message_queue.hpp"
+#include "zpp_include/zero_copy_message_queue.hpp"
+#include "zpp_include/zpp_assert.hpp"
+#include "zpp_include/zpp_test.hpp"
+
+// test helpers
+#include "zpp_benchmark.hpp"
+
+namespace {
+
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""s;
+
+constexpr auto kSuiteName               = "zero_copy_message_queue";
+constexpr uint32_t kQueueSize           = 4;
+constexpr uint32_t kNbrOfBenchmarkItems = 200;
+constexpr auto kTimeout                 = 100ms;
+
+template <size_t PayloadSize> struct Frame {
+  uint32_t sequence = 0;
+  std::array<uint8_t, PayloadSize> payload;
+};
+
+using SmallQueue = zpp_lib::ZeroCopyMessageQueue<Frame<16>, kQueueSize>;
+
+// compares the cost of transferring frames of PayloadSize bytes with a copying and
+// with a zero copy message queue
+template <size_t PayloadSize> void benchmark_payload_size() {
+  using BenchFrame = Frame<PayloadSize>;
+  // frames are too large for the thread stacks
+  static zpp_lib::MessageQueue<BenchFrame, kQueueSize> copy_queue;
+  static zpp_lib::ZeroCopyMessageQueue<BenchFrame, kQueueSize> zero_copy_queue;
+  static BenchFrame tx_frame;
+  static BenchFrame rx_frame;
+
+  auto copy_cycles = zpp_lib::benchmark::measure_transfer(
+      kNbrOfBenchmarkItems,
+      [](uint32_t sequence) {
+        tx_frame.sequence = sequence;
+        memset(tx_frame.payload.data(), static_cast<int>(sequence), PayloadSize);
+        zpp_zassert_true(copy_queue.try_put_for(1s, tx_frame), "Cannot put frame");
+      },
+      []() {
+        zpp_zassert_true(copy_queue.try_get_for(kTimeout, rx_frame), "No frame received");
+        return rx_frame.sequence;
+      });
+
+  using Message         = typename zpp_lib::ZeroCopyMessageQueue<BenchFrame, kQueueSize>::Message;
+  auto zero_copy_cycles = zpp_lib::benchmark::measure_transfer(
+      kNbrOfBenchmarkItems,
+      [](uint32_t sequence) {
+        Message message;
+        zpp_zassert_true(zero_copy_queue.try_allocate_for(1s, message), "Cannot allocate frame");
+        message->sequence = sequence;
+        memset(message->payload.data(), static_cast<int>(sequence), PayloadSize);
+        zpp_zassert_true(zero_copy_queue.try_put_for(1s, message), "Cannot put frame");
+      },
+      []() {
+        Message message;
+        zpp_zassert_true(zero_copy_queue.try_get_for(kTimeout, message), "No frame received");
+        return message->sequence;
+      });
+
+  std::array<char, 48> name = {};
+  snprintk(name.data(), name.size(), "copy_transfer_%u", static_cast<unsigned>(PayloadSize));
+  zpp_lib::benchmark::report_value(kSuiteName, name.data(), "cycles", copy_cycles);
+  snprintk(name.data(), name.size(), "zero_copy_transfer_%u", static_cast<unsigned>(PayloadSize));
+  zpp_lib::benchmark::report_value(kSuiteName, name.data(), "cycles", zero_copy_cycles);
+}
+
+}  // namespace
+
+ZPP_ZTEST(zpp_zero_copy_message_queue, test_put_get) {
+  SmallQueue queue;
+
+  // TESTPOINT: the consumer receives the block filled by the producer, not a copy
+  SmallQueue::Message message;
+  zpp_zassert_true(queue.try_allocate_for(0ms, message) && message, "Cannot allocate message");
+  Frame<16>* p_frame = message.get();
+  message->sequence  = 1;
+  zpp_zassert_true(queue.try_put_for(0ms, message), "Cannot put message");
+  zpp_zassert_true(!message, "Message still owned after put");
+  zpp_zassert_equal(queue.get_nbr_of_queued_messages(), 1, "Wrong number of queued messages");
+  SmallQueue::Message received;
+  zpp_zassert_true(queue.try_get_for(0ms, received), "Cannot get message");
+  zpp_zassert_true(received.get() == p_frame && received->sequence == 1, "Wrong message received");
+
+  // TESTPOINT: the block is returned to the pool when the handle is reset
+  zpp_zassert_equal(queue.get_nbr_of_free_blocks(), kQueueSize - 1, "Wrong number of free blocks");
+  received.reset();
+  zpp_zassert_equal(queue.get_nbr_of_free_blocks(), kQueueSize, "Block not returned to the pool");
+
+  // TESTPOINT: getting from an empty queue expires
+  auto res = queue.try_get_for(5ms, received);
+  zpp_zassert_true(!res.has_error() && !res, "Message received from an empty queue");
+}
+
+ZPP_ZTEST(zpp_zero_copy_message_queue, test_pool_exhaustion) {
+  SmallQueue queue;
+
+  // TESTPOINT: allocation expires once all blocks are in use
+  std::array<SmallQueue::Message, kQueueSize> messages;
+  for (auto& message : messages) {
+    zpp_zassert_true(queue.try_allocate_for(0ms, message), "Cannot allocate message");
+  }
+  SmallQueue::Message message;
+  auto res = queue.try_allocate_for(5ms, message);
+  zpp_zassert_true(!res.has_error() && !res, "Message allocated from an empty pool");
+
+  // TESTPOINT: a message that is moved keeps its block, a released one frees it
+  message = std::move(messages[0]);
+  zpp_zassert_true(message && !messages[0], "Message not moved");
+  zpp_zassert_equal(queue.get_nbr_of_free_blocks(), 0, "Wrong number of free blocks");
+  message.reset();
+  zpp_zassert_true(queue.try_allocate_for(0ms, messages[0]), "Block not returned to the pool");
+}
+
+ZPP_ZTEST(zpp_zero_copy_message_queue, test_benchmark_payload_size) {
+  benchmark_payload_size<64>();
+  benchmark_payload_size<1024>();
+  benchmark_payload_size<4096>();
+}
+
+ZPP_ZTEST_SUITE(zpp_zero_copy_message_queue, nullptr, nullptr, nullptr, nullptr, nullptr);
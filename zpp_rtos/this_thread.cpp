@@ -51,6 +51,59 @@ void set_priority(PreemptableThreadPriority priority) {
   k_thread_priority_set(tid, preemptable_thread_priority_to_zephyr_prio(priority));
 }
 
+void set_priority(CooperativeThreadPriority priority) {
+  k_tid_t tid = k_current_get();
+#if ASSERT
+  ZPP_ASSERT(tid != nullptr, "Current thread has no tid");
+#endif
+  k_thread_priority_set(tid, cooperative_thread_priority_to_zephyr_prio(priority));
+}
+
+bool is_cooperative() {
+  k_tid_t tid = k_current_get();
+#if ASSERT
+  ZPP_ASSERT(tid != nullptr, "Current thread has no tid");
+#endif
+  return k_thread_priority_get(tid) < 0;
+}
+
+uint8_t get_cpu() {
+#if CONFIG_SMP
+  // prevent migration while reading the CPU index
+  unsigned int key = arch_irq_lock();
+  uint8_t cpu      = static_cast<uint8_t>(arch_curr_cpu()->id);
+  arch_irq_unlock(key);
+  return cpu;
+#else   // CONFIG_SMP
+  return 0;
+#endif  // CONFIG_SMP
+}
+
+#if CONFIG_SCHED_CPU_MASK
+uint32_t get_cpu_mask() {
+  return k_current_get()->base.cpu_mask;
+}
+#endif  // CONFIG_SCHED_CPU_MASK
+
+#if CONFIG_SCHED_DEADLINE
+void set_deadline(const std::chrono::microseconds& deadline) {
+  ZPP_ASSERT(deadline.count() > 0, "Invalid deadline %lld us", deadline.count());
+  uint64_t cycles = k_us_to_cyc_ceil64(static_cast<uint64_t>(deadline.count()));
+  ZPP_ASSERT(cycles <= static_cast<uint64_t>(INT32_MAX), "Deadline %lld us is too large", deadline.count());
+  k_thread_deadline_set(k_current_get(), static_cast<int>(cycles));
+}
+
+std::chrono::milliseconds release_at(const std::chrono::microseconds& release_time, const std::chrono::microseconds& relative_deadline) {
+  // the deadline is relative to the current time: a deadline that is already
+  // missed is set to the shortest possible deadline
+  // NOLINTNEXTLINE(readability-math-missing-parentheses) -- this is a zephyr macro
+  auto now      = std::chrono::microseconds(k_ticks_to_us_floor64(static_cast<uint64_t>(k_uptime_ticks())));
+  auto deadline = release_time + relative_deadline - now;
+  set_deadline(deadline.count() > 0 ? deadline : std::chrono::microseconds(1));
+  return sleep_until(release_time);
+}
+#endif  // CONFIG_SCHED_DEADLINE
+
 void busy_wait(const std::chrono::microseconds& waitTime) {
   // k_busy_wait takes usecs
   k_busy_wait(waitTime.count());
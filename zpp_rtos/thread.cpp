@@ -37,12 +37,15 @@
 // zpp_lib
 #include "zpp_include/zpp_assert.hpp"
 #include "zpp_include/zpp_log.hpp"
+#include "zpp_rtos/thread_pool_size.hpp"
 
 #if CONFIG_USERSPACE
 extern struct k_mem_partition zpp_lib_partition;
 #define ZPP_LIB_DATA K_APP_DMEM(zpp_lib_partition)
+#define ZPP_LIB_BSS K_APP_BMEM(zpp_lib_partition)
 #else
 #define ZPP_LIB_DATA
+#define ZPP_LIB_BSS
 #endif  // CONFIG_USERSPACE
 
 ZPP_LOG_MODULE_REGISTER(zpp_rtos, CONFIG_ZPP_RTOS_LOG_LEVEL);
@@ -50,42 +53,203 @@ ZPP_LOG_MODULE_REGISTER(zpp_rtos, CONFIG_ZPP_RTOS_LOG_LEVEL);
 namespace zpp_lib {
 
 // DECLARE STATIC GLOBAL VARIABLES
-// Allocate stacks for threads created with zpp_lib
+// Allocate stacks for threads created with zpp_lib, one array per stack size class
 // NOLINTBEGIN(readibility-identifier-naming,
 // cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
 static K_THREAD_STACK_ARRAY_DEFINE(zpp_threads_stacks, CONFIG_ZPP_THREAD_POOL_SIZE, CONFIG_ZPP_THREAD_STACK_SIZE);
+#if CONFIG_ZPP_THREAD_STACK_512_POOL_SIZE > 0
+static K_THREAD_STACK_ARRAY_DEFINE(zpp_threads_stacks_512, CONFIG_ZPP_THREAD_STACK_512_POOL_SIZE, 512);
+#endif  // CONFIG_ZPP_THREAD_STACK_512_POOL_SIZE > 0
+#if CONFIG_ZPP_THREAD_STACK_1K_POOL_SIZE > 0
+static K_THREAD_STACK_ARRAY_DEFINE(zpp_threads_stacks_1k, CONFIG_ZPP_THREAD_STACK_1K_POOL_SIZE, 1024);
+#endif  // CONFIG_ZPP_THREAD_STACK_1K_POOL_SIZE > 0
+#if CONFIG_ZPP_THREAD_STACK_2K_POOL_SIZE > 0
+static K_THREAD_STACK_ARRAY_DEFINE(zpp_threads_stacks_2k, CONFIG_ZPP_THREAD_STACK_2K_POOL_SIZE, 2048);
+#endif  // CONFIG_ZPP_THREAD_STACK_2K_POOL_SIZE > 0
+#if CONFIG_ZPP_THREAD_STACK_4K_POOL_SIZE > 0
+static K_THREAD_STACK_ARRAY_DEFINE(zpp_threads_stacks_4k, CONFIG_ZPP_THREAD_STACK_4K_POOL_SIZE, 4096);
+#endif  // CONFIG_ZPP_THREAD_STACK_4K_POOL_SIZE > 0
 // NOLINTEND(readibility-identifier-naming,
 // cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
 
 // Allocate a static k_thread array for preventing crashes in the SystemView tracing
 // library and more generally for preventing stack overflow that may happen if we allocate
 // too large objects on the stack (zephyr requirement)
+// There is one k_thread per pre-allocated stack, all stack size classes included
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays,cppcoreguidelines-avoid-non-const-global-variables)
-static struct k_thread thread_data[CONFIG_ZPP_THREAD_POOL_SIZE] = {nullptr};
-
+static struct k_thread thread_data[ZPP_THREAD_TOTAL_POOL_SIZE] = {nullptr};
+
+// Description of a stack size class. The stacks of a class are mapped to the
+// contiguous range [first_slot, first_slot + pool_size[ of thread_data.
+struct StackPool {
+  k_thread_stack_t* stacks;  // first stack of the class
+  size_t stride;             // distance between two consecutive stacks of the class
+  size_t stack_size;         // usable size of each stack
+  uint8_t pool_size;         // number of stacks in the class
+  uint8_t first_slot;        // index of the k_thread used by the first stack
+};
+
+// Each stack class is mapped after the previous one in thread_data
+static constexpr uint8_t kFirstSlot512 = CONFIG_ZPP_THREAD_POOL_SIZE;
+static constexpr uint8_t kFirstSlot1k  = kFirstSlot512 + CONFIG_ZPP_THREAD_STACK_512_POOL_SIZE;
+static constexpr uint8_t kFirstSlot2k  = kFirstSlot1k + CONFIG_ZPP_THREAD_STACK_1K_POOL_SIZE;
+static constexpr uint8_t kFirstSlot4k  = kFirstSlot2k + CONFIG_ZPP_THREAD_STACK_2K_POOL_SIZE;
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-array-to-pointer-decay,cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+static const StackPool kStackPools[] = {
+    {zpp_threads_stacks[0],
+     sizeof(zpp_threads_stacks[0]),
+     K_THREAD_STACK_SIZEOF(zpp_threads_stacks[0]),
+     CONFIG_ZPP_THREAD_POOL_SIZE,
+     0},
+#if CONFIG_ZPP_THREAD_STACK_512_POOL_SIZE > 0
+    {zpp_threads_stacks_512[0],
+     sizeof(zpp_threads_stacks_512[0]),
+     K_THREAD_STACK_SIZEOF(zpp_threads_stacks_512[0]),
+     CONFIG_ZPP_THREAD_STACK_512_POOL_SIZE,
+     kFirstSlot512},
+#endif  // CONFIG_ZPP_THREAD_STACK_512_POOL_SIZE > 0
+#if CONFIG_ZPP_THREAD_STACK_1K_POOL_SIZE > 0
+    {zpp_threads_stacks_1k[0],
+     sizeof(zpp_threads_stacks_1k[0]),
+     K_THREAD_STACK_SIZEOF(zpp_threads_stacks_1k[0]),
+     CONFIG_ZPP_THREAD_STACK_1K_POOL_SIZE,
+     kFirstSlot1k},
+#endif  // CONFIG_ZPP_THREAD_STACK_1K_POOL_SIZE > 0
+#if CONFIG_ZPP_THREAD_STACK_2K_POOL_SIZE > 0
+    {zpp_threads_stacks_2k[0],
+     sizeof(zpp_threads_stacks_2k[0]),
+     K_THREAD_STACK_SIZEOF(zpp_threads_stacks_2k[0]),
+     CONFIG_ZPP_THREAD_STACK_2K_POOL_SIZE,
+     kFirstSlot2k},
+#endif  // CONFIG_ZPP_THREAD_STACK_2K_POOL_SIZE > 0
+#if CONFIG_ZPP_THREAD_STACK_4K_POOL_SIZE > 0
+    {zpp_threads_stacks_4k[0],
+     sizeof(zpp_threads_stacks_4k[0]),
+     K_THREAD_STACK_SIZEOF(zpp_threads_stacks_4k[0]),
+     CONFIG_ZPP_THREAD_STACK_4K_POOL_SIZE,
+     kFirstSlot4k},
+#endif  // CONFIG_ZPP_THREAD_STACK_4K_POOL_SIZE > 0
+};
+// NOLINTEND(cppcoreguidelines-pro-bounds-array-to-pointer-decay,cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+static constexpr size_t kNbrOfStackPools = ARRAY_SIZE(kStackPools);
+
+// Busy flag of each k_thread/stack pair (slot). Slots are claimed and released with
+// atomic bit operations, so that threads may be created and joined concurrently
+// and in any order. A slot is released only once its thread has been joined, which
+// guarantees that a stack is never reused while its thread is still running.
 #if CONFIG_USERSPACE
-// initialize static data members
-// s_thread_instance_count must be located in app domain since
-// it is accessed by the thread
-ZPP_LIB_DATA uint8_t Thread::s_thread_instance_count                        = 0;
-ZPP_LIB_DATA Thread::task_function_t ZPP_TASKS[CONFIG_ZPP_THREAD_POOL_SIZE] = {nullptr};
+// the slot bitmap and the tasks must be located in app domain since
+// they are accessed by user threads
+ZPP_LIB_BSS static ATOMIC_DEFINE(s_thread_slots_busy, ZPP_THREAD_TOTAL_POOL_SIZE);
+ZPP_LIB_DATA Thread::task_function_t ZPP_TASKS[ZPP_THREAD_TOTAL_POOL_SIZE] = {nullptr};
 #else   // CONFIG_USERSPACE
-uint8_t Thread::s_thread_instance_count = 0;
+static ATOMIC_DEFINE(s_thread_slots_busy, ZPP_THREAD_TOTAL_POOL_SIZE);
 #endif  // CONFIG_USERSPACE
 
+// Claims a free slot in the smallest stack size class that fits the requested
+// stack size, trying larger classes when a class is exhausted.
+// Returns kNoSlot if no stack is available.
+static uint8_t claim_slot(size_t stack_size) {
+  uint32_t tried_pools = 0;
+  while (true) {
+    size_t pool_index = kNbrOfStackPools;
+    for (size_t index = 0; index < kNbrOfStackPools; index++) {
+      // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+      const StackPool& pool = kStackPools[index];
+      if ((tried_pools & BIT(index)) == 0 && pool.stack_size >= stack_size &&
+          (pool_index == kNbrOfStackPools || pool.stack_size < kStackPools[pool_index].stack_size)) {
+        pool_index = index;
+      }
+      // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+    if (pool_index == kNbrOfStackPools) {
+      return Thread::kNoSlot;
+    }
+    tried_pools |= BIT(pool_index);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    const StackPool& pool = kStackPools[pool_index];
+    for (uint8_t stack_index = 0; stack_index < pool.pool_size; stack_index++) {
+      const uint8_t slot = pool.first_slot + stack_index;
+      if (!atomic_test_and_set_bit(s_thread_slots_busy, slot)) {
+        return slot;
+      }
+    }
+  }
+}
+
+// returns the stack class owning the given slot
+static const StackPool& slot_to_stack_pool(uint8_t slot) {
+  size_t pool_index = 0;
+  for (size_t index = 0; index < kNbrOfStackPools; index++) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    if (slot >= kStackPools[index].first_slot) {
+      pool_index = index;
+    }
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+  return kStackPools[pool_index];
+}
+
+#if CONFIG_SCHED_CPU_MASK
+// Restricts the CPUs on which a created but not yet started thread may run
+static int apply_cpu_mask(k_tid_t tid, uint32_t cpu_mask) {
+#if CONFIG_SCHED_CPU_MASK_PIN_ONLY
+  // the mask contains a single CPU (checked in Thread::set_cpu_mask)
+  return k_thread_cpu_pin(tid, static_cast<int>(u32_count_trailing_zeros(cpu_mask)));
+#else   // CONFIG_SCHED_CPU_MASK_PIN_ONLY
+  int ret = k_thread_cpu_mask_clear(tid);
+  for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS && ret == 0; cpu++) {
+    if ((cpu_mask & BIT(cpu)) != 0) {
+      ret = k_thread_cpu_mask_enable(tid, cpu);
+    }
+  }
+  return ret;
+#endif  // CONFIG_SCHED_CPU_MASK_PIN_ONLY
+}
+#endif  // CONFIG_SCHED_CPU_MASK
+
+#if CONFIG_SCHED_DEADLINE
+// converts a relative deadline to cycles, returns 0 if the deadline is out of range
+static int deadline_to_cycles(const std::chrono::microseconds& deadline) {
+  if (deadline.count() <= 0) {
+    return 0;
+  }
+  uint64_t cycles = k_us_to_cyc_ceil64(static_cast<uint64_t>(deadline.count()));
+  return cycles > static_cast<uint64_t>(INT32_MAX) ? 0 : static_cast<int>(cycles);
+}
+#endif  // CONFIG_SCHED_DEADLINE
+
 #if CONFIG_USERSPACE
-Thread::Thread(PreemptableThreadPriority priority, const char* name, bool userMode)
+Thread::Thread(PreemptableThreadPriority priority, const char* name, bool userMode, size_t stack_size)
+    : Thread(preemptable_thread_priority_to_zephyr_prio(priority), name, userMode, stack_size) {
+}
+
+Thread::Thread(CooperativeThreadPriority priority, const char* name, bool userMode, size_t stack_size)
+    : Thread(cooperative_thread_priority_to_zephyr_prio(priority), name, userMode, stack_size) {
+}
+
+Thread::Thread(int zephyr_priority, const char* name, bool userMode, size_t stack_size)
     :
 #else   // CONFIG_USERSPACE
-Thread::Thread(PreemptableThreadPriority priority, const char* name)
+Thread::Thread(PreemptableThreadPriority priority, const char* name, size_t stack_size)
+    : Thread(preemptable_thread_priority_to_zephyr_prio(priority), name, stack_size) {
+}
+
+Thread::Thread(CooperativeThreadPriority priority, const char* name, size_t stack_size)
+    : Thread(cooperative_thread_priority_to_zephyr_prio(priority), name, stack_size) {
+}
+
+Thread::Thread(int zephyr_priority, const char* name, size_t stack_size)
     :
 #endif  // CONFIG_USERSPACE
-      _priority(priority), _name(name != nullptr ? name : "application_unnamed_thread")
+      _priority(zephyr_priority),
+      _name(name != nullptr ? name : "application_unnamed_thread"),
 #if CONFIG_USERSPACE
-      ,
-      _userMode(userMode)
+      _userMode(userMode),
 #endif  // CONFIG_USERSPACE
-{
+      _stack_size(stack_size) {
 }
 
 Thread::~Thread() {
@@ -94,11 +258,27 @@ Thread::~Thread() {
     auto ret = k_thread_join(_tid, K_FOREVER);
     if (ret != 0) {
       ZPP_LOG_DBG("Failed to join: %d", ret);
+      return;
     }
+    release_slot();
   }
 }
 
-ZephyrResult Thread::start(std::function<void()> task) noexcept {
+void Thread::release_slot() noexcept {
+  if (_slot == kNoSlot) {
+    return;
+  }
+#if CONFIG_USERSPACE
+  // release the task (and its captured state)
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+  ZPP_TASKS[_slot] = nullptr;
+#endif  // CONFIG_USERSPACE
+  ZPP_LOG_DBG("Releasing thread slot %d", _slot);
+  atomic_clear_bit(s_thread_slots_busy, _slot);
+  _slot = kNoSlot;
+}
+
+ZephyrResult Thread::start(task_function_t task) noexcept {
   std::scoped_lock<Mutex> guard(_mutex);
 
   // check that the thread was not already started
@@ -108,15 +288,23 @@ ZephyrResult Thread::start(std::function<void()> task) noexcept {
     return res;
   }
 
-  // the thread stacks are allocated statically
-  ZPP_ASSERT(
-      s_thread_instance_count < CONFIG_ZPP_THREAD_POOL_SIZE, "Too many threads created (pool size is %d)", CONFIG_ZPP_THREAD_POOL_SIZE);
+  // the thread stacks are allocated statically: claim a free stack in the smallest
+  // stack size class that fits the requested stack size
+  _slot = claim_slot(_stack_size);
+  if (_slot == kNoSlot) {
+    ZPP_ASSERT(false, "No free stack of at least %zu bytes (check the thread pool sizes)", _stack_size);
+    res.assign_error(ZephyrErrorCode::Nomem);
+    return res;
+  }
+  const StackPool& pool     = slot_to_stack_pool(_slot);
+  k_thread_stack_t* p_stack = pool.stacks + (static_cast<size_t>(_slot - pool.first_slot) * pool.stride);
 
   // create the thread
   k_timeout_t delay = K_FOREVER;
 #if CONFIG_USERSPACE
   // initialize callback used in Thread::_thunk
-  ZPP_TASKS[s_thread_instance_count] = task;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+  ZPP_TASKS[_slot] = std::move(task);
 
   /* In user mode, initialize this thread with K_FOREVER timeout so we can
    * modify its permissions and then start it.
@@ -128,50 +316,47 @@ ZephyrResult Thread::start(std::function<void()> task) noexcept {
 
   uint32_t options = 0;
 #endif  // CONFIG_USERSPACE
-  int zephyr_priority = preemptable_thread_priority_to_zephyr_prio(_priority);
-  ZPP_LOG_DBG("Creating thread with stack at %p of size %d, priority %d and name %s",
-              zpp_threads_stacks[s_thread_instance_count],
-              K_THREAD_STACK_SIZEOF(zpp_threads_stacks[s_thread_instance_count]),
-              zephyr_priority,
+  ZPP_LOG_DBG("Creating thread with stack at %p of size %zu (requested %zu), priority %d and name %s",
+              static_cast<void*>(p_stack),
+              pool.stack_size,
+              _stack_size,
+              _priority,
               _name.c_str());
   // k_thread_create returns k_tid_t that is in fact typedef struct k_thread *k_tid_t;
-  // so the return value of k_thread_create is in fact _thread_data initialized
+  // so the return value of k_thread_create is in fact thread_data initialized
 #if CONFIG_USERSPACE
-  _tid = k_thread_create(&_thread_data[s_thread_instance_count],
-                         // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
-                         zpp_threads_stacks[s_thread_instance_count],
-                         // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
-                         K_THREAD_STACK_SIZEOF(zpp_threads_stacks[s_thread_instance_count]),
-                         Thread::s_thunk,
-                         // cppcheck-suppress cstyleCast
-                         // NOLINTNEXTLINE(readability/casting)
-                         (void*)static_cast<uint32_t>(s_thread_instance_count),  // MISRA-suppress: 7.2.1  legacy API,
-                                                                                 // reviewed by Serge 2026-03-11
-                         _event._p_event,
-                         _mutex._p_mutex,
-                         zephyr_priority,
-                         options,
-                         delay);
+  _tid = k_thread_create(
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      &thread_data[_slot],
+      p_stack,
+      pool.stack_size,
+      Thread::s_thunk,
+      // cppcheck-suppress cstyleCast
+      // NOLINTNEXTLINE(readability/casting, modernize-avoid-c-style-cast)
+      (void*)static_cast<uintptr_t>(_slot),  // MISRA-suppress: 7.2.1  legacy API
+      _event._p_event,
+      nullptr,
+      _priority,
+      options,
+      delay);
 #else   // CONFIG_USERSPACE
   _tid = k_thread_create(
       // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
-      &thread_data[s_thread_instance_count],
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index,cppcoreguidelines-pro-bounds-array-to-pointer-decay)
-      zpp_threads_stacks[s_thread_instance_count],
-      K_THREAD_STACK_SIZEOF(
-          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index,cppcoreguidelines-pro-bounds-array-to-pointer-decay)
-          zpp_threads_stacks[s_thread_instance_count]),
+      &thread_data[_slot],
+      p_stack,
+      pool.stack_size,
       Thread::s_thunk,
       // cppcheck-suppress cstyleCast
       // NOLINTNEXTLINE(readability/casting, modernize-avoid-c-style-cast)
       (void*)this,  // MISRA-suppress: 7.2.1  legacy API, reviewed by Serge 2026-03-11
       nullptr,
       nullptr,
-      zephyr_priority,
+      _priority,
       options,
       delay);
 #endif  // CONFIG_USERSPACE
   if (_tid == nullptr) {
+    release_slot();
     ZPP_ASSERT(false, "_tid is null");
     res.assign_error(ZephyrErrorCode::Nomem);
     return res;
@@ -179,23 +364,49 @@ ZephyrResult Thread::start(std::function<void()> task) noexcept {
   auto ret = k_thread_name_set(_tid, _name.c_str());
   if (ret != 0) {
     ZPP_ASSERT(false, "Cannot set name: %d", ret);
+    // the thread was never started: discard it and release its slot
+    k_thread_abort(_tid);
+    _tid = nullptr;
+    release_slot();
     res.assign_error(zephyr_to_zpp_error_code(ret));
     return res;
   }
 
+#if CONFIG_SCHED_CPU_MASK
+  // the CPU mask can only be modified before the thread is started
+  if (_cpu_mask != kAllCpusMask) {
+    ret = apply_cpu_mask(_tid, _cpu_mask);
+    if (ret != 0) {
+      ZPP_ASSERT(false, "Cannot set CPU mask 0x%x: %d", _cpu_mask, ret);
+      // the thread was never started: discard it and release its slot
+      k_thread_abort(_tid);
+      _tid = nullptr;
+      release_slot();
+      res.assign_error(zephyr_to_zpp_error_code(ret));
+      return res;
+    }
+  }
+#endif  // CONFIG_SCHED_CPU_MASK
+
+#if CONFIG_SCHED_DEADLINE
+  // the deadline is relative to the time at which the thread is started
+  if (_deadline.count() > 0) {
+    k_thread_deadline_set(_tid, deadline_to_cycles(_deadline));
+  }
+#endif  // CONFIG_SCHED_DEADLINE
+
 #if CONFIG_USERSPACE
-  // Grant access to the internal _event and _mutex attributes
+  // Grant access to the internal _event attribute
   _event.grant_access(_tid);
-  _mutex.grant_access(_tid);
 #endif  // CONFIG_USERSPACE
 
-  // Wake up the thread (after setting name and granting access)
-  ZPP_LOG_DBG("Thread %p (instance count %d) starting", static_cast<void*>(_tid), s_thread_instance_count);
+  // Wake up the thread (after setting name, CPU mask and granting access)
+  ZPP_LOG_DBG("Thread %p (slot %d) starting", static_cast<void*>(_tid), _slot);
+#if CONFIG_ZPP_THREAD_STATS
+  _start_ticks = k_uptime_ticks();
+#endif  // CONFIG_ZPP_THREAD_STATS
   k_thread_start(_tid);
 
-  // update the thread instance count
-  s_thread_instance_count++;
-
   return res;
 }
 
@@ -223,8 +434,9 @@ ZephyrResult Thread::join() noexcept {
     res = _mutex.lock();
     ZPP_ASSERT(res, "Cannot lock mutex in join: %d", static_cast<int>(res.error()));
 
-    // reset tid
+    // reset tid and release the k_thread/stack pair for other threads
     _tid = nullptr;
+    release_slot();
   }
 
   res = _mutex.unlock();
@@ -239,19 +451,117 @@ k_tid_t Thread::get_tid() const noexcept {
 }
 #endif  // CONFIG_USERSPACE
 
+#if CONFIG_ZPP_THREAD_STATS
+ZephyrResult Thread::get_stats(ThreadStats& stats) const noexcept {
+  ZephyrResult res;
+  if (_tid == nullptr) {
+    res.assign_error(ZephyrErrorCode::Srch);
+    return res;
+  }
+
+  k_thread_runtime_stats_t runtime_stats = {};
+  auto ret                               = k_thread_runtime_stats_get(_tid, &runtime_stats);
+  if (ret != 0) {
+    ZPP_LOG_ERR("Cannot get runtime stats: %d", ret);
+    res.assign_error(zephyr_to_zpp_error_code(ret));
+    return res;
+  }
+  stats.execution_cycles = runtime_stats.execution_cycles;
+  stats.peak_cycles      = runtime_stats.peak_cycles;
+  stats.average_cycles   = runtime_stats.average_cycles;
+  // the number of scheduling windows is not part of k_thread_runtime_stats_t
+  stats.nbr_of_schedules = static_cast<uint32_t>(_tid->base.usage.num_windows);
+
+  size_t unused_stack_size = 0;
+  ret                      = k_thread_stack_space_get(_tid, &unused_stack_size);
+  if (ret != 0) {
+    ZPP_LOG_ERR("Cannot get stack space: %d", ret);
+    res.assign_error(zephyr_to_zpp_error_code(ret));
+    return res;
+  }
+  stats.stack_size           = _tid->stack_info.size;
+  stats.stack_high_watermark = stats.stack_size - unused_stack_size;
+
+  // NOLINTBEGIN(readability-math-missing-parentheses) -- these are zephyr macros
+  auto lifetime_us = static_cast<int64_t>(k_ticks_to_us_floor64(static_cast<uint64_t>(k_uptime_ticks() - _start_ticks)));
+  auto running_us  = static_cast<int64_t>(k_cyc_to_us_floor64(stats.execution_cycles));
+  // NOLINTEND(readability-math-missing-parentheses)
+  stats.running_time = std::chrono::microseconds(running_us);
+  stats.waiting_time = std::chrono::microseconds(lifetime_us > running_us ? lifetime_us - running_us : 0);
+  return res;
+}
+#endif  // CONFIG_ZPP_THREAD_STATS
+
+#if CONFIG_SCHED_DEADLINE
+ZephyrResult Thread::set_deadline(const std::chrono::microseconds& deadline) noexcept {
+  std::scoped_lock<Mutex> guard(_mutex);
+
+  ZephyrResult res;
+  int cycles = deadline_to_cycles(deadline);
+  if (cycles == 0) {
+    ZPP_LOG_ERR("Invalid deadline %lld us", deadline.count());
+    res.assign_error(ZephyrErrorCode::Inval);
+    return res;
+  }
+  if (_tid == nullptr) {
+    // applied in start()
+    _deadline = deadline;
+    return res;
+  }
+  k_thread_deadline_set(_tid, cycles);
+  return res;
+}
+#endif  // CONFIG_SCHED_DEADLINE
+
+#if CONFIG_SCHED_CPU_MASK
+ZephyrResult Thread::set_cpu_mask(uint32_t cpu_mask) noexcept {
+  std::scoped_lock<Mutex> guard(_mutex);
+
+  ZephyrResult res;
+  if (_tid != nullptr) {
+    res.assign_error(ZephyrErrorCode::Already);
+    return res;
+  }
+  if (cpu_mask == 0 || (cpu_mask & ~kAllCpusMask) != 0) {
+    ZPP_LOG_ERR("Invalid CPU mask 0x%x", cpu_mask);
+    res.assign_error(ZephyrErrorCode::Inval);
+    return res;
+  }
+#if CONFIG_SCHED_CPU_MASK_PIN_ONLY
+  if (!IS_POWER_OF_TWO(cpu_mask)) {
+    ZPP_LOG_ERR("CPU mask 0x%x must contain a single CPU", cpu_mask);
+    res.assign_error(ZephyrErrorCode::Inval);
+    return res;
+  }
+#endif  // CONFIG_SCHED_CPU_MASK_PIN_ONLY
+  _cpu_mask = cpu_mask;
+  return res;
+}
+
+ZephyrResult Thread::pin_to_cpu(uint8_t cpu) noexcept {
+  if (cpu >= CONFIG_MP_MAX_NUM_CPUS) {
+    ZPP_LOG_ERR("Invalid CPU %d", cpu);
+    return ZephyrResult(ZephyrErrorCode::Inval);
+  }
+  return set_cpu_mask(BIT(cpu));
+}
+
+uint32_t Thread::get_cpu_mask() const noexcept {
+  return _cpu_mask;
+}
+#endif  // CONFIG_SCHED_CPU_MASK
+
 // Complexity is increased by Zephyr Macros
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 void Thread::s_thunk(void* p1, void* p2, void* p3) {
 #if CONFIG_USERSPACE
   // cppcheck-suppress cstyleCast
-  uint32_t threadInstanceIndex = (uint32_t)p1;  // NOLINT(readability/casting)
-  ZPP_LOG_DBG("Thread _thunk called for thread %p (index %d)", static_cast<void*>(k_current_get()), threadInstanceIndex);
+  auto slot = static_cast<uint8_t>((uintptr_t)p1);  // NOLINT(readability/casting)
+  ZPP_LOG_DBG("Thread _thunk called for thread %p (slot %d)", static_cast<void*>(k_current_get()), slot);
   Event event(static_cast<k_event*>(p2));
-  Mutex mutex(static_cast<k_mutex*>(p3));
 #else   // CONFIG_USERSPACE
   auto* t      = static_cast<Thread*>(p1);
   Event& event = t->_event;
-  Mutex& mutex = t->_mutex;
 #endif  // CONFIG_USERSPACE
 
   // signal that the start was effectively started
@@ -260,18 +570,13 @@ void Thread::s_thunk(void* p1, void* p2, void* p3) {
   // invoke the task
   ZPP_LOG_DBG("Invoking the thread task");
 #if CONFIG_USERSPACE
-  ZPP_TASKS[threadInstanceIndex]();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+  ZPP_TASKS[slot]();
 #else   // CONFIG_USERSPACE
   t->_task();
 #endif  // CONFIG_USERSPACE
 
-  ZPP_LOG_DBG("Task done: exiting the thread (locking mutex)");
-  {
-    std::scoped_lock<Mutex> guard(mutex);
-    // remove this thread from the existing threads
-    s_thread_instance_count--;
-    ZPP_LOG_DBG("Job is marked finished, unlocking mutex");
-  }
+  // the k_thread/stack pair is released when the thread is joined
   ZPP_LOG_DBG("Exiting _thunk");
 }
 
@@ -0,0 +1,36 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file thread_pool_size.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Number of statically allocated zpp_lib threads, all stack size classes
+ *        included. Used for sizing the thread pool and the kernel object pools
+ *        (one k_mutex and one k_event per thread in user mode).
+ *
+ * @date 2025-08-31
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// These values must be usable in preprocessor expressions (see mutexes.def and
+// events.def), they are thus defined as macros
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#define ZPP_THREAD_STACK_CLASSES_POOL_SIZE                                                  \
+  (CONFIG_ZPP_THREAD_STACK_512_POOL_SIZE + CONFIG_ZPP_THREAD_STACK_1K_POOL_SIZE + \
+   CONFIG_ZPP_THREAD_STACK_2K_POOL_SIZE + CONFIG_ZPP_THREAD_STACK_4K_POOL_SIZE)
+#define ZPP_THREAD_TOTAL_POOL_SIZE (CONFIG_ZPP_THREAD_POOL_SIZE + ZPP_THREAD_STACK_CLASSES_POOL_SIZE)
+// NOLINTEND(cppcoreguidelines-macro-usage)
@@ -35,6 +35,14 @@
 #include <cstring>
 
 // zpp_lib
+#if CONFIG_USERSPACE
+#include "zpp_include/condition_variable.hpp"
+#include "zpp_include/event.hpp"
+#include "zpp_include/kernel_object_pool.hpp"
+#include "zpp_include/message_queue.hpp"
+#include "zpp_include/mutex.hpp"
+#include "zpp_include/semaphore.hpp"
+#endif  // CONFIG_USERSPACE
 #include "zpp_include/zpp_log.hpp"
 
 ZPP_LOG_MODULE_DECLARE(zpp_rtos, CONFIG_ZPP_RTOS_LOG_LEVEL);
@@ -196,4 +204,37 @@ void Utils::log_cpu_load() {
 #endif  // CONFIG_CPU_LOAD
 }
 
+#if CONFIG_ZPP_MUTEX_STATS
+void Utils::log_mutex_stats(const Mutex& mutex) {
+  MutexStats stats = mutex.get_stats();
+  ZPP_LOG_INF("=== Mutex %s ===", stats.name ? stats.name : "Unnamed");
+  ZPP_LOG_INF("\tAcquisitions:      %u (%u contended)", stats.nbr_of_acquisitions, stats.nbr_of_contended_acquisitions);
+  ZPP_LOG_INF("\tTotal wait:        %lld us", stats.total_wait_time.count());
+  ZPP_LOG_INF("\tMax wait:          %lld us (owner %s)",
+              stats.max_wait_time.count(),
+              stats.nbr_of_contended_acquisitions > 0 ? stats.worst_wait_owner : "none");
+  ZPP_LOG_INF("\tMax hold:          %lld us\n", stats.max_hold_time.count());
+}
+#endif  // CONFIG_ZPP_MUTEX_STATS
+
+#if CONFIG_USERSPACE
+static void log_kernel_object_pool(const char* name, const KernelObjectPoolStats& stats) {
+  ZPP_LOG_INF("%-10s | %4zu / %-4zu | %4zu | %4zu", name, stats.nbr_of_used, stats.size, stats.max_nbr_of_used, stats.nbr_of_failures);
+}
+
+void Utils::log_kernel_object_pools() {
+  ZPP_LOG_INF("=== Kernel Object Pools ===");
+  ZPP_LOG_INF("Pool       | Used / Size | Peak | Fail");
+  ZPP_LOG_INF("-----------+-------------+------+-----");
+  log_kernel_object_pool("k_mutex", Mutex::get_pool_stats());
+  log_kernel_object_pool("k_sem", Semaphore::get_pool_stats());
+  log_kernel_object_pool("k_condvar", ConditionVariable::get_pool_stats());
+#if CONFIG_EVENTS
+  log_kernel_object_pool("k_event", Event::get_pool_stats());
+#endif  // CONFIG_EVENTS
+  log_kernel_object_pool("k_msgq", gMsgqPool.get_stats());
+  ZPP_LOG_INF("-----------+-------------+------+-----\n");
+}
+#endif  // CONFIG_USERSPACE
+
 }  // namespace zpp_lib